@@ -3,20 +3,23 @@
 #include "src/module_manager.h"
 #include "src/display_module.h"
 #include "src/settings_module.h"
+#include "src/boot_profile.h"
 
+// Boot order is fixed by what the first frame needs. settings_module::begin()
+// and brightness_module::begin() (from earlyInit()) run here, ahead of the
+// module_manager registry, which lists them again: their own begun/attached
+// guards make the second call a no-op. The mux scan and settings dump now
+// print from boot_profile::update() after the first frame.
 void setup() {
+  boot_profile::mark(boot_profile::Milestone::SetupEntry);
   Serial.begin(115200);
-  delay(200);
 
-  settings_module::begin();   // <-- initialize NVS and load saved values (must be before any getters)
-  mux_module::begin();
-  mux_module::debug_scan_once();
-  settings_module::dumpToSerial();
+  settings_module::begin();   // NVS + saved values; brightness reads them in earlyInit()
+  boot_profile::mark(boot_profile::Milestone::SettingsLoaded);
   display_module::earlyInit();
+  boot_profile::mark(boot_profile::Milestone::Splash);
   module_manager::begin_all();
-
-  // Debug: dump settings after modules have initialized preferences
-  settings_module::dumpToSerial();
+  boot_profile::mark(boot_profile::Milestone::ModulesBegun);
 }
 
 void loop() {
@@ -0,0 +1,66 @@
+# Converts a PNG/BMP into an RLE565 image header for src/image_module.h
+# Run from the repo root in PowerShell, e.g.
+#   ./image_to_rle565.ps1 -Source art/splash.png -Name SPLASH -Out splash_fragment.h
+# and paste the fragment inside "namespace images" in src/images/*.h
+#
+# Stream format (see image_module.h):
+#   op 0x00..0x7F : run of (op + 1) pixels, followed by one big-endian RGB565 colour
+#   op 0x80..0xFF : (op - 0x7F) literal big-endian RGB565 colours follow
+
+param(
+    [Parameter(Mandatory = $true)][string]$Source,
+    [Parameter(Mandatory = $true)][string]$Name,
+    [Parameter(Mandatory = $true)][string]$Out
+)
+
+Add-Type -AssemblyName System.Drawing
+
+function To-RGB565([System.Drawing.Color]$c) {
+    return ((($c.R -shr 3) -shl 11) -bor (($c.G -shr 2) -shl 5) -bor ($c.B -shr 3))
+}
+
+$bmp = [System.Drawing.Bitmap]::FromFile((Resolve-Path $Source))
+$w = $bmp.Width
+$h = $bmp.Height
+$px = New-Object 'System.Collections.Generic.List[int]'
+for ($y = 0; $y -lt $h; $y++) {
+    for ($x = 0; $x -lt $w; $x++) { $px.Add((To-RGB565 $bmp.GetPixel($x, $y))) }
+}
+$bmp.Dispose()
+
+$bytes = New-Object 'System.Collections.Generic.List[byte]'
+$n = $px.Count
+$i = 0
+while ($i -lt $n) {
+    # Run: two or more identical pixels
+    $j = $i
+    while (($j + 1) -lt $n -and $px[$j + 1] -eq $px[$i] -and ($j - $i) -lt 127) { $j++ }
+    if ($j -gt $i) {
+        $bytes.Add([byte]($j - $i))
+        $bytes.Add([byte]($px[$i] -shr 8)); $bytes.Add([byte]($px[$i] -band 0xFF))
+        $i = $j + 1
+        continue
+    }
+    # Literal: up to 128 pixels, stopping where a run begins
+    $j = $i
+    while ($j -lt $n -and ($j - $i) -lt 128 -and -not ((($j + 1) -lt $n) -and $px[$j + 1] -eq $px[$j])) { $j++ }
+    if ($j -eq $i) { $j = $i + 1 }
+    $bytes.Add([byte](0x80 -bor ($j - $i - 1)))
+    for ($k = $i; $k -lt $j; $k++) {
+        $bytes.Add([byte]($px[$k] -shr 8)); $bytes.Add([byte]($px[$k] -band 0xFF))
+    }
+    $i = $j
+}
+
+$sb = New-Object System.Text.StringBuilder
+[void]$sb.AppendLine("// ${Name}: ${w}x${h}, $($bytes.Count) bytes RLE565 (raw $($w * $h * 2))")
+[void]$sb.AppendLine("static const uint8_t ${Name}_DATA[] PROGMEM = {")
+for ($k = 0; $k -lt $bytes.Count; $k += 16) {
+    $row = $bytes.GetRange($k, [Math]::Min(16, $bytes.Count - $k)) | ForEach-Object { "0x{0:X2}" -f $_ }
+    [void]$sb.AppendLine("  " + ($row -join ", ") + ",")
+}
+[void]$sb.AppendLine("};")
+[void]$sb.AppendLine("static const image_module::Image $Name = { $w, $h, sizeof(${Name}_DATA), ${Name}_DATA };")
+
+Set-Content -Path $Out -Value $sb.ToString() -Encoding ASCII
+Write-Host "$Name written to $Out ($($bytes.Count) bytes, raw $($w * $h * 2))." -ForegroundColor Green
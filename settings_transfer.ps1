@@ -0,0 +1,104 @@
+# Settings export/import for deep_control over the USB serial console
+# Run from PowerShell with the device connected (close the Arduino serial monitor first)
+#
+#   .\settings_transfer.ps1 -Port COM5 -Export rig.cfg      # save the unit's settings
+#   .\settings_transfer.ps1 -Port COM5 -Import rig.cfg      # load them into a unit
+#   .\settings_transfer.ps1 -Port COM5 -RoundTrip           # export, import, export, compare
+#
+# The file is the device's own "cfg export" output: one "cfg i ..." command per
+# line, ending with "cfg i end <crc32>". See src/settings_transfer.h.
+
+param(
+    [Parameter(Mandatory = $true)][string]$Port,
+    [int]$Baud = 115200,
+    [string]$Export,
+    [string]$Import,
+    [switch]$RoundTrip,
+    [int]$TimeoutMs = 3000
+)
+
+# ===== CRC-32 (IEEE, same as the firmware) over "<line>`n" for every framed line but "end" =====
+function Get-TransferCrc([string[]]$lines) {
+    # literals above 0x7FFFFFFF are negative Int32 in PowerShell, so spell them as uint32
+    [uint32]$poly = 3988292384   # 0xEDB88320
+    [uint32]$crc  = [uint32]::MaxValue
+    foreach ($line in $lines) {
+        if ($line -like "cfg i end *") { break }
+        $bytes = [System.Text.Encoding]::ASCII.GetBytes($line.Substring(6) + "`n")
+        foreach ($b in $bytes) {
+            $crc = $crc -bxor [uint32]$b
+            for ($k = 0; $k -lt 8; $k++) {
+                if ($crc -band 1) { $crc = ($crc -shr 1) -bxor $poly } else { $crc = $crc -shr 1 }
+            }
+        }
+    }
+    return [uint32]($crc -bxor [uint32]::MaxValue)
+}
+
+function Test-TransferFile([string[]]$lines) {
+    $end = $lines | Where-Object { $_ -like "cfg i end *" } | Select-Object -Last 1
+    if (-not $end) { throw "No 'cfg i end' line found." }
+    $want = [Convert]::ToUInt32($end.Substring(10).Trim(), 16)
+    $got  = Get-TransferCrc $lines
+    if ($want -ne $got) { throw ("CRC mismatch: file says {0:X8}, content is {1:X8}" -f $want, $got) }
+}
+
+function Open-Device {
+    $sp = New-Object System.IO.Ports.SerialPort $Port, $Baud, "None", 8, "One"
+    $sp.NewLine = "`n"
+    $sp.ReadTimeout = $TimeoutMs
+    $sp.DtrEnable = $true
+    $sp.Open()
+    Start-Sleep -Milliseconds 200
+    $sp.DiscardInBuffer()
+    return $sp
+}
+
+function Invoke-Export($sp) {
+    $sp.WriteLine("cfg export")
+    $lines = @()
+    while ($true) {
+        $line = $sp.ReadLine().TrimEnd("`r")
+        if ($line -like "cfg i *") { $lines += $line }
+        if ($line -like "cfg i end *") { break }
+    }
+    Test-TransferFile $lines
+    return $lines
+}
+
+function Invoke-Import($sp, [string[]]$lines) {
+    Test-TransferFile $lines
+    $sw = [System.Diagnostics.Stopwatch]::StartNew()
+    # Pace lines so the device's small USB CDC receive buffer never overflows
+    foreach ($line in $lines) { $sp.WriteLine($line); Start-Sleep -Milliseconds 5 }
+    while ($true) {
+        $reply = $sp.ReadLine().TrimEnd("`r")
+        if ($reply -like '`[cfg`] import*') { break }
+    }
+    $sw.Stop()
+    if ($reply -notlike '`[cfg`] import ok*') { throw "Device rejected the import: $reply" }
+    Write-Host "$reply (host round trip $($sw.ElapsedMilliseconds) ms)" -ForegroundColor Green
+}
+
+$sp = Open-Device
+try {
+    if ($Export) {
+        $lines = Invoke-Export $sp
+        $lines | Set-Content $Export -Encoding ASCII
+        Write-Host "Exported $($lines.Count) lines to $Export" -ForegroundColor Green
+    }
+    if ($Import) {
+        $lines = Get-Content $Import | Where-Object { $_ -like "cfg i *" }
+        Invoke-Import $sp $lines
+    }
+    if ($RoundTrip) {
+        $a = Invoke-Export $sp
+        Invoke-Import $sp $a
+        $b = Invoke-Export $sp
+        if (($a -join "`n") -ne ($b -join "`n")) { throw "Round trip changed the settings image." }
+        Write-Host "Round trip OK ($($a.Count) lines, identical export)" -ForegroundColor Green
+    }
+}
+finally {
+    $sp.Close()
+}
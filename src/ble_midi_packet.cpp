@@ -0,0 +1,154 @@
+// =============================
+// File: src/ble_midi_packet.cpp
+// =============================
+#include "ble_midi_packet.h"
+#include "midi_din.h"   // messageLength()
+
+using midi_din::messageLength;
+
+bool ble_midi_packet::Packetizer::add(uint16_t tsMs, uint8_t status, uint8_t d1, uint8_t d2) {
+  tsMs &= 0x1FFF;
+  const uint8_t hi      = (uint8_t)(tsMs >> 7);
+  const uint8_t msgLen  = messageLength(status);
+  const bool    channel = status < 0xF0;
+  const bool    omit    = channel && status == running && !empty();
+  const uint8_t limit   = cap < MAX_PAYLOAD ? cap : MAX_PAYLOAD;
+
+  if (!empty() && hi != tsHigh) return false;
+  const uint8_t need = (empty() ? 1 : 0) + 1 + (omit ? 0 : 1) + (msgLen - 1);
+  if (len + need > limit) return false;
+
+  if (empty()) { buf[len++] = (uint8_t)(0x80 | hi); tsHigh = hi; }
+  buf[len++] = (uint8_t)(0x80 | (tsMs & 0x7F));
+  if (!omit)      buf[len++] = status;
+  if (msgLen > 1) buf[len++] = d1 & 0x7F;
+  if (msgLen > 2) buf[len++] = d2 & 0x7F;
+  if (channel) running = status;
+  else if (status < 0xF8) running = 0;   // system common cancels, realtime does not
+  ++msgs;
+  return true;
+}
+
+bool ble_midi_packet::decode(const uint8_t* p, uint8_t n, MessageFn fn, void* ctx) {
+  if (n < 3 || !(p[0] & 0x80) || !(p[1] & 0x80)) return false;
+  uint8_t hi = p[0] & 0x3F, lastLo = 0, running = 0;
+  uint16_t ts = 0;
+  uint8_t i = 1;
+  while (i < n) {
+    if (p[i] & 0x80) {                       // timestamp byte
+      const uint8_t lo = p[i++] & 0x7F;
+      if (lo < lastLo) hi = (hi + 1) & 0x3F;  // low bits wrapped inside the packet
+      lastLo = lo;
+      ts = (uint16_t)((hi << 7) | lo);
+      if (i >= n) return false;
+    }
+    if (p[i] & 0x80) {                       // status
+      const uint8_t s = p[i++];
+      if (s < 0xF0) running = s; else if (s < 0xF8) running = 0;
+      if (s >= 0xF0) {
+        const uint8_t len = messageLength(s);
+        if (i + len - 1 > n) return false;
+        fn(ctx, ts, s, len > 1 ? p[i] : 0, len > 2 ? p[i + 1] : 0);
+        i += len - 1;
+        continue;
+      }
+    } else if (!running) {
+      return false;                          // data without a status in force
+    }
+    const uint8_t len = messageLength(running);
+    if (i + len - 1 > n) return false;
+    for (uint8_t k = 0; k + 1 < len; ++k) if (p[i + k] & 0x80) return false;
+    fn(ctx, ts, running, p[i], len > 2 ? p[i + 1] : 0);
+    i += len - 1;
+  }
+  return true;
+}
+
+// -------- loopback --------
+namespace {
+  struct Sent { uint16_t ts; uint8_t status, d1, d2; uint32_t queuedUs; };
+
+  struct Loop {
+    static constexpr uint8_t PENDING = 32;
+    Sent     pending[PENDING];
+    uint8_t  head = 0, count = 0;     // messages queued in the open packet(s), oldest first
+    uint32_t packets = 0, msgs = 0, bytes = 0, mismatches = 0, maxPerPacket = 0;
+    uint32_t delaySumUs = 0, delayMaxUs = 0;
+    uint32_t nowUs = 0;
+  };
+
+  void onDecoded(void* ctx, uint16_t ts, uint8_t s, uint8_t d1, uint8_t d2) {
+    Loop& L = *(Loop*)ctx;
+    if (!L.count) { ++L.mismatches; return; }
+    const Sent& e = L.pending[L.head];
+    if (e.ts != ts || e.status != s || e.d1 != d1 || e.d2 != d2) ++L.mismatches;
+    const uint32_t d = L.nowUs - e.queuedUs;
+    L.delaySumUs += d;
+    if (d > L.delayMaxUs) L.delayMaxUs = d;
+    L.head = (L.head + 1) % Loop::PENDING;
+    --L.count;
+    ++L.msgs;
+  }
+
+  void flush(Loop& L, ble_midi_packet::Packetizer& pk) {
+    if (pk.empty()) return;
+    ++L.packets;
+    L.bytes += pk.len;
+    if (pk.msgs > L.maxPerPacket) L.maxPerPacket = pk.msgs;
+    if (!ble_midi_packet::decode(pk.buf, pk.len, onDecoded, &L)) ++L.mismatches;
+    pk.reset();
+  }
+
+  void runCase(Print& out, uint8_t mtu, uint16_t intervalUs) {
+    Loop L;
+    ble_midi_packet::Packetizer pk;
+    pk.cap = (uint8_t)(mtu - 3);
+    int16_t last[4] = { -1, -1, -1, -1 };
+    uint32_t nextFlushUs = intervalUs;
+
+    for (uint32_t tMs = 0; tMs < 2000; ++tMs) {
+      // 4 faders in 500 ms triangle sweeps plus a stomp every 125 ms (as midi_wire_sim)
+      Sent m[5]; uint8_t n = 0;
+      for (uint8_t f = 0; f < 4; ++f) {
+        const uint32_t ph = (tMs + f * 250) % 1000, pos = ph < 500 ? ph : 1000 - ph;
+        const int16_t v = (int16_t)(pos * 127 / 500);
+        if (v != last[f]) { last[f] = v; m[n++] = { 0, 0xB0, (uint8_t)(20 + f), (uint8_t)v, 0 }; }
+      }
+      if (tMs % 125 == 0) m[n++] = { 0, 0xB0, (uint8_t)(80 + (tMs / 125) % 4), (uint8_t)((tMs / 500) % 2 ? 0 : 127), 0 };
+
+      L.nowUs = tMs * 1000UL;
+      while (L.nowUs >= nextFlushUs) { flush(L, pk); nextFlushUs += intervalUs; }
+      for (uint8_t i = 0; i < n; ++i) {
+        m[i].ts = (uint16_t)(tMs & 0x1FFF);
+        m[i].queuedUs = L.nowUs;
+        if (!pk.add(m[i].ts, m[i].status, m[i].d1, m[i].d2)) {   // full: send now, start a new one
+          flush(L, pk);
+          pk.add(m[i].ts, m[i].status, m[i].d1, m[i].d2);
+        }
+        if (L.count == Loop::PENDING) { ++L.mismatches; continue; }
+        L.pending[(L.head + L.count++) % Loop::PENDING] = m[i];
+      }
+    }
+    L.nowUs = nextFlushUs;
+    flush(L, pk);
+
+    out.print(F("  mtu=")); out.print(mtu);
+    out.print(F(" interval=")); out.print(intervalUs / 1000.0f, 2); out.print(F("ms"));
+    out.print(F(" packets=")); out.print(L.packets);
+    out.print(F(" msgs=")); out.print(L.msgs);
+    out.print(F(" msgs/notify avg=")); out.print(L.packets ? (float)L.msgs / L.packets : 0.0f, 2);
+    out.print(F(" max=")); out.print(L.maxPerPacket);
+    out.print(F(" bytes/msg=")); out.print(L.msgs ? (float)L.bytes / L.msgs : 0.0f, 2);
+    out.print(F(" batch delay avg/max=")); out.print(L.msgs ? L.delaySumUs / 1000.0f / L.msgs : 0.0f, 2);
+    out.print('/'); out.print(L.delayMaxUs / 1000.0f, 2); out.print(F("ms"));
+    out.print(F(" mismatches=")); out.println(L.mismatches);
+  }
+}
+
+void ble_midi_packet::loopback(Print& out) {
+  out.println(F("[ble loop] packetize -> decode, 2 s of fader sweeps + stomps"));
+  runCase(out, 23, 7500);
+  runCase(out, 23, 15000);
+  runCase(out, 67, 7500);
+  runCase(out, 67, 15000);
+}
@@ -0,0 +1,42 @@
+// =============================
+// File: src/ble_midi_packet.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// BLE-MIDI packet format (Apple / MMA spec), independent of the BLE stack:
+//   header     1 0 t12..t7             (high 6 bits of a 13-bit ms timestamp)
+//   per msg    1 t6..t0  [status]  data...
+// Several messages share one packet; a channel status equal to the previous
+// one in the packet is omitted (running status, reset per packet). Every
+// message in a packet must share the header's timestamp high bits, so the
+// packetizer reports "full" when they change.
+namespace ble_midi_packet {
+  constexpr uint8_t MAX_PAYLOAD = 64;          // ATT MTU 67; the default MTU 23 gives 20
+
+  struct Packetizer {
+    uint8_t buf[MAX_PAYLOAD];
+    uint8_t len      = 0;
+    uint8_t cap      = 20;   // ATT MTU - 3, clamped to MAX_PAYLOAD
+    uint8_t msgs     = 0;
+    uint8_t tsHigh   = 0;
+    uint8_t running  = 0;    // last channel status written in this packet
+
+    void reset() { len = 0; msgs = 0; running = 0; }
+    bool empty() const { return len == 0; }
+    // false: does not fit (flush and add again); only channel and 1-3 byte
+    // system messages are supported (no SysEx).
+    bool add(uint16_t tsMs, uint8_t status, uint8_t d1, uint8_t d2);
+  };
+
+  // Calls fn once per message with its full 13-bit timestamp. Returns false on
+  // a malformed packet (messages before the fault have been delivered).
+  typedef void (*MessageFn)(void* ctx, uint16_t tsMs, uint8_t status, uint8_t d1, uint8_t d2);
+  bool decode(const uint8_t* p, uint8_t n, MessageFn fn, void* ctx);
+
+  // Loopback stand-in for the radio: packetizes synthetic fader/stomp
+  // traffic with one flush per connection interval, decodes every packet and
+  // checks it against what was sent. Prints msgs/notification and batching
+  // delay for a few MTU / interval combinations.
+  void loopback(Print& out);
+}
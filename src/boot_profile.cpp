@@ -0,0 +1,61 @@
+// =============================
+// File: src/boot_profile.cpp
+// =============================
+#include "boot_profile.h"
+#include <esp_timer.h>
+#include "mux_module.h"
+#include "settings_module.h"
+
+#ifndef BOOT_REPORT_DELAY_MS
+#define BOOT_REPORT_DELAY_MS 1500UL   // lets the USB host attach before anything is printed
+#endif
+
+// 1 = also print the mux scan and settings dump that used to run in setup()
+#ifndef BOOT_DEBUG_DUMPS
+#define BOOT_DEBUG_DUMPS 1
+#endif
+
+using boot_profile::Milestone;
+
+namespace {
+  static constexpr uint8_t COUNT = (uint8_t)Milestone::Count;
+
+  static const char* const NAMES[COUNT] = {
+    "setup entry", "settings loaded", "splash", "modules begun", "first frame", "midi ready", "ble advertising"
+  };
+
+  static int64_t s_at[COUNT] = { -1, -1, -1, -1, -1, -1, -1 };
+  static bool    s_reported  = false;
+}
+
+void boot_profile::mark(Milestone m) {
+  if ((uint8_t)m < COUNT && s_at[(uint8_t)m] < 0) s_at[(uint8_t)m] = esp_timer_get_time();
+}
+
+bool    boot_profile::reached(Milestone m) { return (uint8_t)m < COUNT && s_at[(uint8_t)m] >= 0; }
+int64_t boot_profile::atUs(Milestone m)    { return (uint8_t)m < COUNT ? s_at[(uint8_t)m] : -1; }
+
+void boot_profile::update() {
+  if (s_reported || !reached(Milestone::FirstFrame)) return;
+  if (esp_timer_get_time() - atUs(Milestone::FirstFrame) < (int64_t)BOOT_REPORT_DELAY_MS * 1000) return;
+  s_reported = true;
+
+  printReport(Serial);
+#if BOOT_DEBUG_DUMPS
+  mux_module::debug_scan_once();
+  settings_module::dumpToSerial(Serial);
+#endif
+}
+
+void boot_profile::printReport(Print& out) {
+  out.println(F("[boot] milestone          at ms   +ms"));
+  int64_t prev = 0;
+  for (uint8_t i = 0; i < COUNT; ++i) {
+    out.print(F("[boot] ")); out.print(NAMES[i]);
+    for (size_t pad = strlen(NAMES[i]); pad < 18; ++pad) out.print(' ');
+    if (s_at[i] < 0) { out.println(F("     -")); continue; }
+    out.print((float)s_at[i] / 1000.0f, 1);
+    out.print(F("  ")); out.println((float)(s_at[i] - prev) / 1000.0f, 1);
+    prev = s_at[i];
+  }
+}
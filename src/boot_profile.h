@@ -0,0 +1,29 @@
+// =============================
+// File: src/boot_profile.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// Boot milestones timestamped with esp_timer (µs since the app started), and
+// the debug output that used to run before the first frame. update() prints
+// the report plus the optional dumps once the first frame has been on screen
+// for BOOT_REPORT_DELAY_MS, so they no longer delay it.
+namespace boot_profile {
+  enum class Milestone : uint8_t {
+    SetupEntry,      // first line of setup()
+    SettingsLoaded,  // NVS blob read, getters valid
+    Splash,          // panel initialised, splash on screen
+    ModulesBegun,    // module_manager::begin_all() returned
+    FirstFrame,      // first setup/play screen drawn
+    MidiReady,       // DIN UART installed: MIDI goes out with no host attached
+    BleAdvertising,  // BLE MIDI service advertising (a central still has to connect)
+    Count
+  };
+
+  void    mark(Milestone m);      // first call per milestone wins
+  bool    reached(Milestone m);
+  int64_t atUs(Milestone m);      // -1 if not reached
+
+  void update();                  // deferred report + dumps, once
+  void printReport(Print& out = Serial);
+}
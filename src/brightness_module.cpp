@@ -0,0 +1,178 @@
+// =============================
+// File: src/brightness_module.cpp
+// =============================
+#include "brightness_module.h"
+#include <driver/ledc.h>
+#include "pinmap_module.h"
+#include "settings_module.h"
+#include "mode_manager.h"
+#include "display_module.h"
+
+#ifndef BRIGHTNESS_DIM_AFTER_MS
+#define BRIGHTNESS_DIM_AFTER_MS 30000UL   // play mode: dim backlight after 30 s idle
+#endif
+#ifndef BRIGHTNESS_OFF_AFTER_MS
+#define BRIGHTNESS_OFF_AFTER_MS 180000UL  // play mode: backlight + LEDs off after 3 min idle
+#endif
+
+using brightness_module::Channel;
+
+namespace {
+  // 12-bit duty at ~19.5 kHz (80 MHz APB / 4096): above the audible range, and
+  // fine enough that the lowest levels differ by more than one or two LSBs.
+  static constexpr uint8_t  PWM_BITS = 12;
+  static constexpr uint32_t PWM_FREQ = 19500;
+
+  static constexpr uint16_t DIM_FADE_MS = 1500;
+  static constexpr uint16_t OFF_FADE_MS = 800;
+  static constexpr uint8_t  DIM_LEVEL   = 3;    // backlight level while dimmed
+  static constexpr uint16_t SETTING_FADE_MS = 60;
+
+  // Perceptual backlight curve (1..20). Index 0 is unused; no true OFF from setup.
+  static const uint16_t TFT_DUTY_TABLE[21] = {
+    /*0 (unused)*/ 0,
+    /*1*/ 24, 40, 72, 120, 190, 290, 420, 590, 800, 1060,
+    /*11*/ 1370, 1734, 2152, 2634, 3051, 3340, 3597, 3822, 3983, 4095
+  };
+
+  // Perceptual LED curve (gamma ~2.6), low end lifted so level 1 still glows
+  static const uint16_t LED_DUTY_TABLE[21] = {
+    0, 8, 20, 40, 70, 112, 177, 267, 378, 514, 675,
+    865, 1085, 1336, 1620, 1938, 2292, 2684, 3114, 3584, 4095
+  };
+
+  enum class Idle : uint8_t { Awake, Dimmed, Off };
+
+  struct Output {
+    uint8_t         pin;
+    uint8_t         ledcChannel;
+    const uint16_t* table;
+    uint8_t         level;      // user level 0..20
+    bool            fading;     // a ledcFade() of ours may still be running
+  };
+
+  static Output s_out[2] = {
+    { pinmap::TFT_BL_PWM, 0, TFT_DUTY_TABLE, brightness_module::LEVEL_MAX, false },
+    { pinmap::LED_PWM,    1, LED_DUTY_TABLE, brightness_module::LEVEL_MAX, false },
+  };
+
+  static bool          s_attached     = false;
+  static Idle          s_idle         = Idle::Awake;
+  static unsigned long s_lastActivity = 0;
+  static unsigned long s_offAt        = 0;
+  static uint32_t      s_dimAfterMs   = BRIGHTNESS_DIM_AFTER_MS;   // as configured; see dimDueMs()
+  static uint32_t      s_offAfterMs   = BRIGHTNESS_OFF_AFTER_MS;
+
+  inline Output& out(Channel ch) { return s_out[(uint8_t)ch]; }
+
+  // Never dim later than the backlight goes off. Clamped here rather than in
+  // setIdleTimeouts() so a shorter off time does not lose the dim setting.
+  inline uint32_t dimDueMs() { return s_dimAfterMs < s_offAfterMs ? s_dimAfterMs : s_offAfterMs; }
+
+  inline uint8_t clampLevel(int v) {
+    return v < 0 ? 0 : (v > brightness_module::LEVEL_MAX ? brightness_module::LEVEL_MAX : (uint8_t)v);
+  }
+
+  // Starting a fade while one is still running would block in the driver until
+  // the first one ends, so a fade of ours is stopped where it is first. Only
+  // ours: before the first ledcFade() installs the fade service,
+  // ledc_fade_stop() fails and IDF logs an error.
+  void driveDuty(Output& o, uint32_t target, uint16_t fadeMs) {
+    if (o.fading) { ledc_fade_stop(LEDC_LOW_SPEED_MODE, (ledc_channel_t)o.ledcChannel); o.fading = false; }
+    const uint32_t from = ledcRead(o.pin);
+    if (fadeMs == 0 || from == target) { ledcWrite(o.pin, target); return; }
+    o.fading = ledcFade(o.pin, from, target, fadeMs);
+  }
+
+  void applyAwake(uint16_t fadeMs) {
+    for (Output& o : s_out) driveDuty(o, o.table[o.level], fadeMs);
+  }
+
+  // Saved levels take effect wherever they were set from (setup, console, profiler)
+  void onSettingChanged(settings_module::Field f, uint8_t) {
+    using settings_module::Field;
+    if (f == Field::TftBrightness)      brightness_module::setLevel(Channel::Backlight, settings_module::getTftBrightness(), SETTING_FADE_MS);
+    else if (f == Field::LedBrightness) brightness_module::setLevel(Channel::Leds, settings_module::getLedBrightness(), SETTING_FADE_MS);
+  }
+}
+
+void brightness_module::begin() {
+  if (s_attached) return;
+  for (Output& o : s_out) {
+    ledcAttachChannel(o.pin, PWM_FREQ, PWM_BITS, o.ledcChannel);
+  }
+  s_attached = true;
+  settings_module::subscribe(settings_module::maskOf(settings_module::Field::TftBrightness) |
+                             settings_module::maskOf(settings_module::Field::LedBrightness), onSettingChanged);
+
+  uint8_t tft = settings_module::getTftBrightness();
+  out(Channel::Backlight).level = tft < 1 ? 1 : clampLevel(tft);
+  out(Channel::Leds).level      = clampLevel(settings_module::getLedBrightness());
+
+  s_idle = Idle::Awake;
+  s_lastActivity = millis();
+  applyAwake(0);
+}
+
+void brightness_module::update() {
+  if (!s_attached) return;
+  const unsigned long now = millis();
+
+  // Idle policy only applies while playing; setup is always lit.
+  if (mode_manager::inSetupMode()) {
+    s_lastActivity = now;
+    if (s_idle != Idle::Awake) { s_idle = Idle::Awake; applyAwake(0); }
+    return;
+  }
+
+  const unsigned long idleFor = now - s_lastActivity;
+  if (s_idle == Idle::Awake && idleFor >= dimDueMs()) {
+    Output& bl = out(Channel::Backlight);
+    const uint8_t dim = bl.level < DIM_LEVEL ? bl.level : DIM_LEVEL;
+    driveDuty(bl, bl.table[dim], DIM_FADE_MS);
+    s_idle = Idle::Dimmed;
+  } else if (s_idle == Idle::Dimmed && idleFor >= s_offAfterMs) {
+    for (Output& o : s_out) driveDuty(o, 0, OFF_FADE_MS);
+    s_idle = Idle::Off;
+    s_offAt = now;
+  }
+}
+
+void brightness_module::setLevel(Channel ch, uint8_t level, uint16_t fadeMs) {
+  Output& o = out(ch);
+  o.level = clampLevel(level);
+  if (ch == Channel::Backlight && o.level < 1) o.level = 1;
+  if (!s_attached) return;
+  if (s_idle == Idle::Awake) driveDuty(o, o.table[o.level], fadeMs);
+}
+
+uint8_t brightness_module::level(Channel ch) { return out(ch).level; }
+
+uint16_t brightness_module::dutyFor(Channel ch, uint8_t level) {
+  return out(ch).table[clampLevel(level)];
+}
+
+bool brightness_module::noteActivity() {
+  const uint32_t edgeUs = micros();
+  s_lastActivity = millis();
+  if (s_idle == Idle::Awake) return false;
+
+  // Panel first so the backlight never lights a sleeping controller
+  const bool panelWasAsleep = display_module::asleep();
+  if (panelWasAsleep) display_module::wake();
+  s_idle = Idle::Awake;
+  applyAwake(0);   // wake is instant; only going idle fades
+  if (panelWasAsleep) display_module::noteWakeLatency(micros() - edgeUs);
+  return true;
+}
+
+bool brightness_module::isDimmed() { return s_idle == Idle::Dimmed; }
+bool brightness_module::isOff()    { return s_idle == Idle::Off; }
+bool brightness_module::isDark()   { return s_idle == Idle::Off && millis() - s_offAt >= OFF_FADE_MS; }
+
+void brightness_module::setIdleTimeouts(uint32_t dimMs, uint32_t offMs) {
+  s_dimAfterMs = dimMs;
+  s_offAfterMs = offMs;
+}
+uint32_t brightness_module::dimAfterMs() { return s_dimAfterMs; }
+uint32_t brightness_module::offAfterMs() { return s_offAfterMs; }
@@ -0,0 +1,36 @@
+// =============================
+// File: src/brightness_module.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// Owns the TFT backlight and fader-LED PWM. Duty is 12-bit LEDC; level changes
+// are handed to the LEDC hardware fader so the CPU does nothing while a fade
+// runs. In play mode the backlight dims, then switches off, after a period
+// without input; any input restores it immediately.
+namespace brightness_module {
+  enum class Channel : uint8_t { Backlight = 0, Leds = 1 };
+
+  constexpr uint8_t LEVEL_MAX = 20;
+
+  void begin();   // attaches both channels; safe to call more than once
+  void update();  // idle policy
+
+  // Set the user level (0..20) for a channel. fadeMs = 0 writes immediately.
+  void    setLevel(Channel ch, uint8_t level, uint16_t fadeMs = 0);
+  uint8_t level(Channel ch);
+  uint16_t dutyFor(Channel ch, uint8_t level);
+
+  // Call on every user input. Returns true if the display was dimmed/off
+  // and has just been restored.
+  bool noteActivity();
+  bool isDimmed();
+  bool isOff();
+  bool isDark();  // off and the fade-out has finished
+
+  // Idle timeouts (ms since last input). offMs is also when the panel sleeps.
+  // Both are kept as given; dimming starts at the earlier of the two.
+  void     setIdleTimeouts(uint32_t dimMs, uint32_t offMs);
+  uint32_t dimAfterMs();
+  uint32_t offAfterMs();
+}
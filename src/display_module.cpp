@@ -1,23 +1,161 @@
 // File: display_module.cpp
 #include "display_module.h"
 #include "pinmap_module.h"
+#include "layout_constants.h"
+#include "image_module.h"
+#include "images/splash.h"
+#include "brightness_module.h"
+#include "settings_module.h"
 #include <SPI.h>
 
-Adafruit_ST7789 display_module::tft(pinmap::TFT_CS, pinmap::TFT_DC, pinmap::TFT_RST);
+display_module::Panel display_module::tft(pinmap::TFT_CS, pinmap::TFT_DC, pinmap::TFT_RST);
+
+namespace {
+  // ST7789 frame memory is 320 lines along the scroll axis; the 1.14" glass
+  // shows 240 of them starting at line 40 (matches Adafruit's 135x240 offsets).
+  constexpr uint16_t PANEL_LINES  = 320;
+  constexpr uint16_t LINE_OFFSET  = (PANEL_LINES - SCREEN_W) / 2;
+
+  constexpr uint8_t CMD_VSCRDEF = 0x33; // vertical scrolling definition
+  constexpr uint8_t CMD_VSCSAD  = 0x37; // vertical scroll start address
+  constexpr uint8_t CMD_SLPIN   = 0x10;
+  constexpr uint8_t CMD_SLPOUT  = 0x11;
+  constexpr uint8_t CMD_DISPOFF = 0x28;
+  constexpr uint8_t CMD_DISPON  = 0x29;
+
+  // ST7789 timing: 5 ms after SLPOUT before the next command, and 120 ms
+  // between any SLPIN and the following SLPOUT (and vice versa).
+  constexpr uint32_t SLPOUT_SETTLE_US  = 5000;
+  constexpr uint32_t SLEEP_TOGGLE_MIN_MS = 120;
+
+  bool     s_scrollActive = false;
+  int16_t  s_bandLeft     = 0;   // first scrolling screen column
+  int16_t  s_bandW        = SCREEN_W;
+  int16_t  s_offset       = 0;   // 0..s_bandW-1, columns scrolled so far
+  uint32_t s_steps        = 0;
+  uint32_t s_pixLast      = 0;
+  uint32_t s_pixTotal     = 0;
+
+  bool          s_asleep      = false;
+  unsigned long s_sleepCmdMs  = 0;   // time of the last SLPIN/SLPOUT
+  uint32_t      s_sleeps      = 0;
+  uint32_t      s_wakeLastUs  = 0;
+  uint32_t      s_wakeMaxUs   = 0;
+
+  void waitSleepToggleWindow() {
+    const unsigned long since = millis() - s_sleepCmdMs;
+    if (since < SLEEP_TOGGLE_MIN_MS) delay(SLEEP_TOGGLE_MIN_MS - since);
+  }
+
+  void writeScrollDefinition(uint16_t tfa, uint16_t vsa, uint16_t bfa) {
+    uint8_t d[6] = { (uint8_t)(tfa >> 8), (uint8_t)tfa,
+                     (uint8_t)(vsa >> 8), (uint8_t)vsa,
+                     (uint8_t)(bfa >> 8), (uint8_t)bfa };
+    display_module::tft.sendCommand(CMD_VSCRDEF, d, 6);
+  }
+
+  void writeScrollStart(uint16_t line) {
+    uint8_t d[2] = { (uint8_t)(line >> 8), (uint8_t)line };
+    display_module::tft.sendCommand(CMD_VSCSAD, d, 2);
+  }
+}
 
 void display_module::earlyInit() {
   Serial.println("Early display init");
   SPI.begin(pinmap::TFT_SCK, -1, pinmap::TFT_MOSI, -1);
   tft.init(135, 240);
   tft.setRotation(3);
+
+  // Splash straight from flash so the panel is not blank while modules begin()
+  image_module::blit(images::SPLASH, 0, 0);
+  brightness_module::begin();
 }
 
 void display_module::begin() {
-  Serial.println("Display begin");
-  pinMode(pinmap::TFT_BL_PWM, OUTPUT);
-  analogWrite(pinmap::TFT_BL_PWM, 255);
+  Serial.println("Display begin");   // brightness_module is begun before this (module_manager)
 }
 
 void display_module::update() {
-  // Intentionally left blank
+  if (!s_asleep && brightness_module::isDark()) sleep();
+}
+
+void display_module::sleep() {
+  if (s_asleep) return;
+  settings_module::flushNow();   // nothing pending across a possible power-off
+  waitSleepToggleWindow();
+  tft.sendCommand(CMD_DISPOFF);
+  tft.sendCommand(CMD_SLPIN);
+  s_sleepCmdMs = millis();
+  s_asleep = true;
+  ++s_sleeps;
+}
+
+void display_module::wake() {
+  if (!s_asleep) return;
+  // Only hit when input arrives within 120 ms of SLPIN; otherwise free
+  waitSleepToggleWindow();
+  tft.sendCommand(CMD_SLPOUT);
+  delayMicroseconds(SLPOUT_SETTLE_US);
+  tft.sendCommand(CMD_DISPON);
+  s_sleepCmdMs = millis();
+  s_asleep = false;
+}
+
+bool display_module::asleep() { return s_asleep; }
+
+void display_module::noteWakeLatency(uint32_t us) {
+  s_wakeLastUs = us;
+  if (us > s_wakeMaxUs) s_wakeMaxUs = us;
+}
+
+void display_module::printSleepStats(Print& out) {
+  out.print(F("[display] sleeps=")); out.print(s_sleeps);
+  out.print(F(" asleep="));          out.print(s_asleep ? F("yes") : F("no"));
+  out.print(F(" wake last/max us=")); out.print(s_wakeLastUs);
+  out.print('/');                    out.println(s_wakeMaxUs);
+}
+
+void display_module::scrollDefine(int16_t fixedLeft, int16_t fixedRight) {
+  if (fixedLeft < 0) fixedLeft = 0;
+  if (fixedRight < 0) fixedRight = 0;
+  if (fixedLeft + fixedRight >= SCREEN_W) return;
+
+  s_bandLeft = fixedLeft;
+  s_bandW    = SCREEN_W - fixedLeft - fixedRight;
+  s_offset   = 0;
+
+  // Fixed areas include the off-glass memory lines at either end
+  const uint16_t tfa = LINE_OFFSET + (uint16_t)fixedLeft;
+  const uint16_t bfa = (PANEL_LINES - LINE_OFFSET - SCREEN_W) + (uint16_t)fixedRight;
+  writeScrollDefinition(tfa, (uint16_t)s_bandW, bfa);
+  writeScrollStart(tfa);
+  s_scrollActive = true;
 }
+
+int16_t display_module::scrollStep(int16_t px) {
+  if (!s_scrollActive || px <= 0) return -1;
+  if (px > s_bandW) px = s_bandW;
+
+  // Columns that scroll off the left edge re-enter on the right: the exposed
+  // strip is whatever memory lines were at the band's left edge before the step.
+  const int16_t exposedX = s_bandLeft + s_offset;
+  s_offset = (int16_t)((s_offset + px) % s_bandW);
+  writeScrollStart((uint16_t)(LINE_OFFSET + s_bandLeft + s_offset));
+
+  s_pixLast   = (uint32_t)px * SCREEN_H;
+  s_pixTotal += s_pixLast;
+  ++s_steps;
+  return exposedX;
+}
+
+void display_module::scrollReset() {
+  writeScrollDefinition(0, PANEL_LINES, 0);
+  writeScrollStart(0);
+  s_scrollActive = false;
+  s_bandLeft = 0; s_bandW = SCREEN_W; s_offset = 0;
+}
+
+bool     display_module::scrollActive()         { return s_scrollActive; }
+uint32_t display_module::scrollSteps()          { return s_steps; }
+uint32_t display_module::scrollPixelsLastStep() { return s_pixLast; }
+uint32_t display_module::scrollPixelsTotal()    { return s_pixTotal; }
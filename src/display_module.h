@@ -3,11 +3,54 @@
 #pragma once
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7789.h>
+
+// Route all drawing through the render/SPI cost profiler (see render_profiler.h)
+#ifndef RENDER_PROFILER
+#define RENDER_PROFILER 1
+#endif
+#if RENDER_PROFILER
+#include "profiled_tft.h"
+#endif
+
 namespace display_module {
-extern Adafruit_ST7789 tft;
+#if RENDER_PROFILER
+using Panel = ProfiledST7789;
+#else
+using Panel = Adafruit_ST7789;
+#endif
+extern Panel tft;
 
   void earlyInit();
   void begin();
   void update();
 
+  // --- Hardware scrolling (ST7789 VSCRDEF / VSCSAD) ---
+  // In rotation 3 the controller's scroll axis runs along screen X, so the
+  // scroll band is a run of screen columns spanning the full panel height.
+  // fixedLeft/fixedRight are columns that stay put at either edge.
+  void    scrollDefine(int16_t fixedLeft, int16_t fixedRight);
+  // Move band content left by px with one register write. Returns the
+  // address-space X of the px-wide strip that is now exposed at the right
+  // edge; draw only there (full height). px should divide the band width.
+  int16_t scrollStep(int16_t px);
+  // Back to identity addressing (caller redraws its screen)
+  void    scrollReset();
+  bool    scrollActive();
+
+  // Telemetry: steps taken and pixels exposed by the last / all steps
+  uint32_t scrollSteps();
+  uint32_t scrollPixelsLastStep();
+  uint32_t scrollPixelsTotal();
+
+  // --- Panel sleep (SLPIN / SLPOUT) ---
+  // The controller keeps its frame memory through SLPIN, so waking shows the
+  // last frame again without redrawing anything. update() puts the panel to
+  // sleep once brightness_module reports the backlight dark; wake() is called
+  // from brightness_module::noteActivity() on the first input.
+  void     sleep();
+  void     wake();
+  bool     asleep();
+  void     noteWakeLatency(uint32_t us);   // input edge -> panel + backlight on
+  void     printSleepStats(Print& out);
+
 }
@@ -7,6 +7,7 @@
 #include "pinmap_module.h"
 #include "mux_module.h"
 #include "setup_module.h"
+#include "brightness_module.h"
 
 #ifndef ENCODER_DEBUG
 #define ENCODER_DEBUG 0 // default off for normal use
@@ -78,6 +79,7 @@ void encoder_module::update() {
   int8_t delta = TRANS[idx];
 
   if (delta != 0) {
+    brightness_module::noteActivity();
     int8_t dir = (delta > 0) ? 1 : -1;
     if (last_dir != 0 && dir != last_dir) {
       mv_sum = 0; // clear remainder on direction change
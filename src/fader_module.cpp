@@ -0,0 +1,231 @@
+// =============================
+// File: src/fader_module.cpp
+// =============================
+#include "fader_module.h"
+#include "pinmap_module.h"
+#include "settings_module.h"
+#include "midi_out.h"
+#include "program_change.h"
+#include "brightness_module.h"
+
+#ifndef FADER_HYSTERESIS
+#define FADER_HYSTERESIS 6      // ADC counts (of 4096) beyond a 7-bit step edge before it moves
+#endif
+
+#ifndef FADER_DEADBAND_HIRES
+#define FADER_DEADBAND_HIRES 8  // 14-bit steps (2 ADC counts) a high-resolution fader must move
+#endif
+
+#ifndef FADER_PICKUP_WINDOW
+#define FADER_PICKUP_WINDOW 256 // 14-bit steps (2 of 128) either side of the target that count as caught
+#endif
+
+namespace {
+  static constexpr uint8_t PINS[fader_module::COUNT] = {
+    pinmap::FADER1_PIN, pinmap::FADER2_PIN, pinmap::FADER3_PIN, pinmap::FADER4_PIN
+  };
+  static constexpr uint8_t  SMOOTH_SHIFT = 2;     // IIR weight 1/4
+  static constexpr uint16_t STEP = 4096 / 128;    // ADC counts per 7-bit step
+
+  static uint16_t s_smooth[fader_module::COUNT];  // 12-bit << SMOOTH_SHIFT
+  static int16_t  s_value[fader_module::COUNT] = { -1, -1, -1, -1 };
+  static int16_t  s_hires[fader_module::COUNT]  = { -1, -1, -1, -1 };   // last 14-bit value sent
+  static uint8_t  s_res[fader_module::COUNT];     // resolution the values above were sent at
+  static bool     s_begun = false;
+
+  // Soft takeover. s_pos is where each fader was (14-bit) when it last sent
+  // in the current location (-1 = not yet); the receiver holds that value until the next preset / scene change.
+  // LOCATIONS remembers those positions per program_change::location(), and
+  // coming back to one suppresses each fader until it reaches its old
+  // position again (s_target, -1 = live).
+  struct Location { uint32_t key; int16_t pos[fader_module::COUNT]; uint32_t usedMs; };
+  static constexpr uint8_t LOCATIONS = 16;
+  static Location s_locs[LOCATIONS];
+  static uint8_t  s_locCount = 0;
+  static uint32_t s_locKey = 0;
+  static uint16_t s_locChanges = 0;
+  static int16_t  s_pos[fader_module::COUNT]    = { -1, -1, -1, -1 };
+  static int16_t  s_target[fader_module::COUNT] = { -1, -1, -1, -1 };
+  static bool     s_above[fader_module::COUNT];   // side of the target the fader started on
+  static uint32_t s_suppressed = 0;
+
+  // New 7-bit value, or the old one while the reading sits within the
+  // hysteresis band around the current step
+  int16_t quantize(uint16_t adc, int16_t last) {
+    const int16_t v = (int16_t)(adc / STEP);
+    if (last < 0 || v == last) return v;
+    const int16_t lo = (int16_t)(last * STEP) - FADER_HYSTERESIS;
+    const int16_t hi = (int16_t)((last + 1) * STEP) + FADER_HYSTERESIS;
+    return ((int16_t)adc < lo || (int16_t)adc >= hi) ? v : last;
+  }
+
+  // The smoothed reading already carries SMOOTH_SHIFT fraction bits: 12 + 2 =
+  // 14, stretched so full travel reaches 16383
+  inline int16_t hires(uint16_t smooth) { return (int16_t)(smooth + (smooth >> 12)); }
+
+  // New 14-bit value, or the old one inside the deadband; the ends always land
+  int16_t quantizeHires(int16_t v, int16_t last) {
+    if (last < 0 || v == 0 || v == 0x3FFF) return v;
+    const int16_t d = v > last ? v - last : last - v;
+    return d >= FADER_DEADBAND_HIRES ? v : last;
+  }
+
+  // 14-bit CC pairs only exist for CC 0..31; higher CCs stay 7-bit
+  uint8_t effectiveRes(uint8_t i) {
+    const uint8_t res = settings_module::getFaderRes(i);
+    if (res == settings_module::FADER_RES_14BIT_CC && settings_module::getFaderCC(i) > 31)
+      return settings_module::FADER_RES_7BIT;
+    return res;
+  }
+
+  Location* findLocation(uint32_t key) {
+    for (uint8_t k = 0; k < s_locCount; ++k) if (s_locs[k].key == key) return &s_locs[k];
+    return nullptr;
+  }
+
+  // Least recently used entry goes when the table is full
+  Location& storeLocation(uint32_t key) {
+    Location* l = findLocation(key);
+    if (!l) {
+      if (s_locCount < LOCATIONS) l = &s_locs[s_locCount++];
+      else { l = &s_locs[0]; for (Location& c : s_locs) if ((int32_t)(c.usedMs - l->usedMs) < 0) l = &c; }
+      l->key = key;
+    }
+    l->usedMs = millis();
+    return *l;
+  }
+
+  // What the receiver held for the old location is what each fader last
+  // sent there, or its target if it never caught up; -1 if it did neither.
+  // For the new one only a position sent there before is known; elsewhere
+  // faders stay live.
+  void changeLocation(uint32_t key) {
+    if (s_locKey != program_change::NO_LOCATION) {
+      Location& old = storeLocation(s_locKey);
+      for (uint8_t i = 0; i < fader_module::COUNT; ++i) old.pos[i] = s_target[i] >= 0 ? s_target[i] : s_pos[i];
+    }
+    for (uint8_t i = 0; i < fader_module::COUNT; ++i) s_pos[i] = -1;   // nothing sent here yet
+    s_locKey = key;
+    const Location* now = findLocation(key);
+    for (uint8_t i = 0; i < fader_module::COUNT; ++i) {
+      s_target[i] = -1;
+      const int16_t at = hires(s_smooth[i]);
+      if (!now || now->pos[i] < 0) continue;
+      const int16_t d = (int16_t)(at - now->pos[i]);
+      if (d > FADER_PICKUP_WINDOW || d < -FADER_PICKUP_WINDOW) {
+        s_target[i] = now->pos[i];
+        s_above[i] = d > 0;
+      }
+    }
+  }
+
+  // true while the fader must not send: still short of its target and on
+  // the side it started
+  bool heldByPickup(uint8_t i) {
+    if (s_target[i] < 0) return false;
+    const int16_t d = (int16_t)(hires(s_smooth[i]) - s_target[i]);
+    if ((d > 0) != s_above[i] || (d <= FADER_PICKUP_WINDOW && d >= -FADER_PICKUP_WINDOW)) {
+      s_target[i] = -1;
+      return false;
+    }
+    return true;
+  }
+
+  bool sendHires(uint8_t i, uint8_t res, int16_t v) {
+    const uint8_t cc = settings_module::getFaderCC(i);
+    if (res == settings_module::FADER_RES_NRPN)
+      return midi_out::nrpn((uint16_t)((settings_module::getFaderNrpnMsb(i) << 7) | cc), (uint16_t)v);
+    return midi_out::controlChange14(cc, (uint16_t)v);
+  }
+}
+
+void fader_module::begin() {
+  if (s_begun) return;
+  s_begun = true;
+  analogReadResolution(12);
+  for (uint8_t i = 0; i < COUNT; ++i) {
+    analogSetPinAttenuation(PINS[i], ADC_11db);   // full 0..3.3 V travel
+    s_smooth[i] = (uint16_t)(analogRead(PINS[i]) << SMOOTH_SHIFT);
+    s_value[i] = quantize((uint16_t)(s_smooth[i] >> SMOOTH_SHIFT), -1);   // no CC at power-up
+    s_hires[i] = hires(s_smooth[i]);
+    s_res[i] = effectiveRes(i);
+    s_pos[i] = -1;   // nothing sent yet: the receiver's value is unknown
+  }
+  s_locKey = program_change::location();
+  s_locChanges = program_change::changes();
+}
+
+void fader_module::update() {
+  if (!s_begun) return;
+  if (program_change::changes() != s_locChanges) {
+    s_locChanges = program_change::changes();
+    changeLocation(program_change::location());
+  }
+  for (uint8_t i = 0; i < COUNT; ++i) {
+    const uint16_t raw = (uint16_t)analogRead(PINS[i]);
+    s_smooth[i] = (uint16_t)(s_smooth[i] - (s_smooth[i] >> SMOOTH_SHIFT) + raw);
+    const uint8_t res = effectiveRes(i);
+    if (res != s_res[i]) { s_res[i] = res; s_value[i] = -1; s_hires[i] = -1; }   // resend at the new resolution
+    if (res != settings_module::FADER_RES_7BIT) {
+      const int16_t h = quantizeHires(hires(s_smooth[i]), s_hires[i]);
+      if (h == s_hires[i]) continue;
+      if (s_hires[i] >= 0) brightness_module::noteActivity();   // a move, not a resolution change
+      if (heldByPickup(i)) { ++s_suppressed; continue; }
+      s_hires[i] = h;
+      s_value[i] = (int16_t)(h >> 7);
+      s_pos[i] = hires(s_smooth[i]);
+      sendHires(i, res, h);
+      continue;
+    }
+    const int16_t v = quantize((uint16_t)(s_smooth[i] >> SMOOTH_SHIFT), s_value[i]);
+    if (v == s_value[i]) continue;
+    if (s_value[i] >= 0) brightness_module::noteActivity();
+    if (heldByPickup(i)) { ++s_suppressed; continue; }
+    s_value[i] = v;
+    s_pos[i] = hires(s_smooth[i]);
+    midi_out::controlChange(settings_module::getFaderCC(i), (uint8_t)v);
+  }
+}
+
+uint8_t fader_module::value(uint8_t fader) {
+  return (fader < COUNT && s_value[fader] >= 0) ? (uint8_t)s_value[fader] : 0;
+}
+
+int16_t fader_module::level(uint8_t fader) {
+  if (fader >= COUNT || !s_begun) return -1;
+  return s_res[fader] == settings_module::FADER_RES_7BIT ? s_value[fader] : s_hires[fader];
+}
+
+uint8_t fader_module::resolution(uint8_t fader) {
+  return fader < COUNT ? s_res[fader] : (uint8_t)settings_module::FADER_RES_7BIT;
+}
+
+bool fader_module::resend(uint8_t fader) {
+  const int16_t v = level(fader);
+  if (v < 0 || s_target[fader] >= 0) return false;   // not picked up: the receiver keeps its own value
+  if (s_res[fader] == settings_module::FADER_RES_7BIT)
+    return midi_out::controlChange(settings_module::getFaderCC(fader), (uint8_t)v);
+  return sendHires(fader, s_res[fader], v);
+}
+
+int8_t fader_module::pickup(uint8_t fader) {
+  if (fader >= COUNT || s_target[fader] < 0) return 0;
+  return s_above[fader] ? -1 : 1;
+}
+
+void fader_module::printStats(Print& out) {
+  static const char* const RES[] = { "7-bit", "14-bit", "nrpn" };
+  out.print(F("[fader] location=0x")); out.print(s_locKey, HEX);
+  out.print(F(" remembered=")); out.print(s_locCount); out.print('/'); out.print(LOCATIONS);
+  out.print(F(" pickup suppressed=")); out.println(s_suppressed);
+  for (uint8_t i = 0; i < COUNT; ++i) {
+    out.print(F("  ")); out.print(i + 1);
+    out.print(' '); out.print(RES[s_res[i] <= settings_module::FADER_RES_NRPN ? s_res[i] : 0]);
+    out.print(F(" level=")); out.print(level(i));
+    if (s_target[i] >= 0) {
+      out.print(F(" pickup ")); out.print(s_above[i] ? F("down to ") : F("up to "));
+      out.print(s_target[i] >> 7); out.print(F(" (at ")); out.print(hires(s_smooth[i]) >> 7); out.print(')');
+    }
+    out.println();
+  }
+}
@@ -0,0 +1,37 @@
+// =============================
+// File: src/fader_module.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// Four fader pots on the ADC. Readings are smoothed, reduced to 7 bits with
+// hysteresis and sent through midi_out as the CC from settings_module, so a
+// fast sweep is coalesced there rather than queued. A fader set to 14-bit
+// (settings_module::FaderRes) sends the smoothed 14-bit reading as a CC
+// MSB/LSB pair or an NRPN instead, with a small deadband in place of the
+// 7-bit hysteresis.
+//
+// Soft takeover: on a preset or scene change (program_change) a fader that
+// last sent from elsewhere in that location is held - nothing reaches
+// midi_out - until it crosses, or comes within FADER_PICKUP_WINDOW of, the
+// position it left the receiver at. Locations never visited are unknown and
+// the faders stay live there.
+namespace fader_module {
+  constexpr uint8_t COUNT = 4;
+
+  void begin();
+  void update();     // one ADC pass over all faders
+
+  uint8_t value(uint8_t fader);   // last value sent, 0..127 (MSB when 14-bit)
+
+  // Last value sent at the fader's resolution (0..127 or 0..16383; -1 before
+  // begin), the settings_module::FaderRes it was sent at, and a resend of it
+  int16_t level(uint8_t fader);
+  uint8_t resolution(uint8_t fader);
+  bool    resend(uint8_t fader);     // false while held by pickup
+
+  // Pickup: +1 move up, -1 move down to take over, 0 = live. play_module
+  // draws it as an arrow, so it shows in play mode only (long mirror press).
+  int8_t pickup(uint8_t fader);
+  void   printStats(Print& out = Serial);
+}
@@ -0,0 +1,67 @@
+// =============================
+// File: src/image_module.cpp
+// =============================
+#include "image_module.h"
+#include "display_module.h"
+#include "layout_constants.h"
+
+using display_module::tft;
+
+namespace {
+  // One screen row of pixels: the only buffer between flash and SPI
+  static uint16_t s_line[SCREEN_W];
+
+  void pushToPanel(uint16_t* px, uint16_t n, void* /*ctx*/) {
+    tft.writePixels(px, n, true, false);
+  }
+}
+
+uint32_t image_module::decode(const Image& img, uint16_t* buf, uint16_t bufLen, PixelSink sink, void* ctx) {
+  if (!img.data || !buf || bufLen == 0 || !sink) return 0;
+
+  const uint32_t total = (uint32_t)img.w * img.h;
+  const uint8_t* p     = img.data;
+  const uint8_t* end   = img.data + img.size;
+  uint32_t done = 0;
+  uint16_t fill = 0;
+
+  while (p < end && done < total) {
+    const uint8_t op = pgm_read_byte(p++);
+    uint16_t count = (uint16_t)(op & 0x7F) + 1;
+    if (done + count > total) count = (uint16_t)(total - done); // never overrun the window
+
+    if (op & 0x80) {
+      // literal; a stream cut short stops here rather than drawing past it
+      if ((uint32_t)(end - p) < 2UL * count) break;
+      for (uint16_t i = 0; i < count; ++i) {
+        buf[fill++] = (uint16_t)((pgm_read_byte(p) << 8) | pgm_read_byte(p + 1));
+        p += 2;
+        if (fill == bufLen) { sink(buf, fill, ctx); fill = 0; }
+      }
+    } else {
+      // run
+      if (p + 1 >= end) break;
+      const uint16_t c = (uint16_t)((pgm_read_byte(p) << 8) | pgm_read_byte(p + 1));
+      p += 2;
+      for (uint16_t i = 0; i < count; ++i) {
+        buf[fill++] = c;
+        if (fill == bufLen) { sink(buf, fill, ctx); fill = 0; }
+      }
+    }
+    done += count;
+  }
+
+  if (fill) sink(buf, fill, ctx);
+  return done;
+}
+
+bool image_module::blit(const Image& img, int16_t x, int16_t y) {
+  if (x < 0 || y < 0 || img.w == 0 || img.h == 0) return false;
+  if (x + (int16_t)img.w > tft.width() || y + (int16_t)img.h > tft.height()) return false;
+
+  tft.startWrite();
+  tft.setAddrWindow(x, y, img.w, img.h);
+  const uint32_t drawn = decode(img, s_line, SCREEN_W, pushToPanel, nullptr);
+  tft.endWrite();
+  return drawn == (uint32_t)img.w * img.h;
+}
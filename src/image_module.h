@@ -0,0 +1,32 @@
+// =============================
+// File: src/image_module.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// Compact RLE565 images kept in flash and streamed straight to the panel.
+//
+// Stream format (pixels in row-major order, colours big-endian RGB565):
+//   op 0x00..0x7F : run     — (op + 1) copies of the next colour (2 bytes)
+//   op 0x80..0xFF : literal — (op - 0x7F) colours follow (2 bytes each)
+// Runs may cross row boundaries. Assets are generated by image_to_rle565.ps1.
+namespace image_module {
+  struct Image {
+    uint16_t       w;
+    uint16_t       h;
+    uint32_t       size;   // bytes in data
+    const uint8_t* data;   // RLE565 stream (PROGMEM)
+  };
+
+  // Decode straight into the SPI address window at (x, y). Images must lie
+  // fully on screen; anything else is rejected without drawing. false also
+  // when the stream ends early (the rest of the window is left as it was).
+  bool blit(const Image& img, int16_t x, int16_t y);
+
+  // Streaming decoder used by blit(): fills buf (bufLen pixels) and hands it
+  // to sink whenever it is full and once more at the end. No full-frame
+  // buffer is ever built. Returns the number of pixels decoded; decoding
+  // stops at the first op whose colours run past the end of the data.
+  typedef void (*PixelSink)(uint16_t* px, uint16_t n, void* ctx);
+  uint32_t decode(const Image& img, uint16_t* buf, uint16_t bufLen, PixelSink sink, void* ctx);
+}
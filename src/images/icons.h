@@ -0,0 +1,75 @@
+// =============================
+// File: src/images/icons.h — image data from image_to_rle565.ps1
+// =============================
+#pragma once
+#include "../image_module.h"
+
+namespace images {
+
+// ICON_BLE: 20x20, 179 bytes RLE565 (raw 800)
+static const uint8_t ICON_BLE_DATA[] PROGMEM = {
+  0x09, 0x00, 0x00, 0x80, 0x03, 0xDF, 0x12, 0x00, 0x00, 0x01, 0x03, 0xDF, 0x11, 0x00, 0x00, 0x02,
+  0x03, 0xDF, 0x10, 0x00, 0x00, 0x03, 0x03, 0xDF, 0x0F, 0x00, 0x00, 0x81, 0x03, 0xDF, 0x00, 0x00,
+  0x02, 0x03, 0xDF, 0x0E, 0x00, 0x00, 0x80, 0x03, 0xDF, 0x01, 0x00, 0x00, 0x01, 0x03, 0xDF, 0x0A,
+  0x00, 0x00, 0x01, 0x03, 0xDF, 0x01, 0x00, 0x00, 0x81, 0x03, 0xDF, 0x00, 0x00, 0x02, 0x03, 0xDF,
+  0x0A, 0x00, 0x00, 0x02, 0x03, 0xDF, 0x80, 0x00, 0x00, 0x03, 0x03, 0xDF, 0x0C, 0x00, 0x00, 0x07,
+  0x03, 0xDF, 0x0C, 0x00, 0x00, 0x04, 0x03, 0xDF, 0x0E, 0x00, 0x00, 0x03, 0x03, 0xDF, 0x0F, 0x00,
+  0x00, 0x04, 0x03, 0xDF, 0x0D, 0x00, 0x00, 0x07, 0x03, 0xDF, 0x0A, 0x00, 0x00, 0x02, 0x03, 0xDF,
+  0x80, 0x00, 0x00, 0x03, 0x03, 0xDF, 0x0B, 0x00, 0x00, 0x01, 0x03, 0xDF, 0x01, 0x00, 0x00, 0x81,
+  0x03, 0xDF, 0x00, 0x00, 0x02, 0x03, 0xDF, 0x0E, 0x00, 0x00, 0x80, 0x03, 0xDF, 0x01, 0x00, 0x00,
+  0x01, 0x03, 0xDF, 0x0E, 0x00, 0x00, 0x81, 0x03, 0xDF, 0x00, 0x00, 0x02, 0x03, 0xDF, 0x0E, 0x00,
+  0x00, 0x03, 0x03, 0xDF, 0x0F, 0x00, 0x00, 0x02, 0x03, 0xDF, 0x10, 0x00, 0x00, 0x01, 0x03, 0xDF,
+  0x07, 0x00, 0x00,
+};
+static const image_module::Image ICON_BLE = { 20, 20, sizeof(ICON_BLE_DATA), ICON_BLE_DATA };
+
+// ICON_DIN: 20x20, 285 bytes RLE565 (raw 800)
+static const uint8_t ICON_DIN_DATA[] PROGMEM = {
+  0x19, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x04, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0x03, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0x01, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0x01, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x00,
+  0x00, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0x01, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0x07, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x00,
+  0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0x0D, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x03, 0x00,
+  0x00, 0x01, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+  0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02,
+  0xFF, 0xFF, 0x06, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x19, 0x00, 0x00,
+};
+static const image_module::Image ICON_DIN = { 20, 20, sizeof(ICON_DIN_DATA), ICON_DIN_DATA };
+
+// ICON_BATTERY: 24x12, 132 bytes RLE565 (raw 576)
+static const uint8_t ICON_BATTERY_DATA[] PROGMEM = {
+  0x14, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x02,
+  0x00, 0x00, 0x80, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x80, 0xFF,
+  0xFF, 0x01, 0x00, 0x00, 0x0E, 0x07, 0xE0, 0x01, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+  0x0E, 0x07, 0xE0, 0x01, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x0E, 0x07, 0xE0, 0x01,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x0E, 0x07, 0xE0, 0x01, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x01, 0x00, 0x00, 0x0E, 0x07, 0xE0, 0x01, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x01, 0x00, 0x00,
+  0x0E, 0x07, 0xE0, 0x01, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x02,
+  0x00, 0x00, 0x80, 0xFF, 0xFF, 0x12, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x14, 0xFF,
+  0xFF, 0x02, 0x00, 0x00,
+};
+static const image_module::Image ICON_BATTERY = { 24, 12, sizeof(ICON_BATTERY_DATA), ICON_BATTERY_DATA };
+
+// ICON_CHARGING: 12x20, 111 bytes RLE565 (raw 480)
+static const uint8_t ICON_CHARGING_DATA[] PROGMEM = {
+  0x06, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x08, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x09, 0x00, 0x00, 0x01,
+  0xFF, 0xE0, 0x08, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x08, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x08, 0x00,
+  0x00, 0x02, 0xFF, 0xE0, 0x07, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x07, 0x00, 0x00, 0x02, 0xFF, 0xE0,
+  0x07, 0x00, 0x00, 0x08, 0xFF, 0xE0, 0x02, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x02, 0x00, 0x00, 0x08,
+  0xFF, 0xE0, 0x07, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x08, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x08, 0x00,
+  0x00, 0x02, 0xFF, 0xE0, 0x08, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x09, 0x00, 0x00, 0x01, 0xFF, 0xE0,
+  0x09, 0x00, 0x00, 0x80, 0xFF, 0xE0, 0x15, 0x00, 0x00, 0x80, 0xFF, 0xE0, 0x12, 0x00, 0x00,
+};
+static const image_module::Image ICON_CHARGING = { 12, 20, sizeof(ICON_CHARGING_DATA), ICON_CHARGING_DATA };
+
+} // namespace images
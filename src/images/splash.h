@@ -0,0 +1,200 @@
+// =============================
+// File: src/images/splash.h — image data from image_to_rle565.ps1
+// =============================
+#pragma once
+#include "../image_module.h"
+
+namespace images {
+
+// SPLASH: 240x135, 2973 bytes RLE565 (raw 64800)
+static const uint8_t SPLASH_DATA[] PROGMEM = {
+  0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x09, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00,
+  0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+  0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F,
+  0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00,
+  0x00, 0x5B, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x12, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x77,
+  0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x0C, 0xFF,
+  0xFF, 0x14, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x03, 0x00, 0x00,
+  0x0B, 0xFF, 0xFF, 0x73, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0D,
+  0x00, 0x00, 0x10, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x05, 0xFF,
+  0xFF, 0x02, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x12, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x12, 0xFF, 0xFF, 0x0B,
+  0x00, 0x00, 0x05, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x12, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0x0C, 0x00, 0x00,
+  0x14, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x11, 0xFF, 0xFF, 0x6E,
+  0x00, 0x00, 0x19, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x08, 0xFF,
+  0xFF, 0x0A, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+  0x19, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x0A,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x08, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x09,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x0A, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0x6A, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x08,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0x0A, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0x69, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x08,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x0C, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0x69, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x08,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x0C, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x68, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x08,
+  0x00, 0x00, 0x05, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x05, 0xFF,
+  0xFF, 0x0D, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x0D, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x0E, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07,
+  0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x07,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x05, 0x00, 0x00,
+  0x1B, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x67,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x1B, 0xFF,
+  0xFF, 0x05, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07,
+  0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x1C,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x67, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x1A, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x67,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x1A, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x08,
+  0x00, 0x00, 0x05, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x0D, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x69, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x1B,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x69, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x0C, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x1A, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x69,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0x19, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x09,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x09, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0x6B, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x0A,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0x0C, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x07, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x04,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x07, 0xFF,
+  0xFF, 0x08, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0x0B, 0x00, 0x00,
+  0x16, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x16, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x11, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x05, 0xFF,
+  0xFF, 0x0C, 0x00, 0x00, 0x15, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x15, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+  0x05, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x71, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x02,
+  0x00, 0x00, 0x05, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x14, 0xFF,
+  0xFF, 0x08, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x74, 0x00, 0x00,
+  0x0B, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x10,
+  0x00, 0x00, 0x10, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x0B, 0xFF,
+  0xFF, 0x77, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x16, 0x00, 0x00,
+  0x0A, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x7F,
+  0x00, 0x00, 0x5B, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00,
+  0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF,
+  0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06,
+  0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x68, 0x00,
+  0x00, 0x06, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0x7F, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x46, 0x00, 0x00,
+  0x02, 0xFF, 0xFF, 0x22, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x46, 0x00, 0x00, 0x02,
+  0xFF, 0xFF, 0x22, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x46, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0x22, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x06, 0xFF, 0xFF,
+  0x05, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x04,
+  0xFF, 0xFF, 0x05, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+  0x7F, 0x00, 0x00, 0x19, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x04,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x08, 0xFF,
+  0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x03, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x04, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+  0x03, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x17, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x08,
+  0x00, 0x00, 0x03, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0x04, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+  0x04, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x03,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x17, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x09, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0x05, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0x07, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x02, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x16, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x05,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0x06, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+  0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x16, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+  0x07, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02,
+  0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x16, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+  0x02, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x07,
+  0x00, 0x00, 0x03, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0x7F, 0x00, 0x00, 0x16, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+  0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02,
+  0xFF, 0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x07, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+  0x7F, 0x00, 0x00, 0x16, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x08, 0x00, 0x00,
+  0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F,
+  0x00, 0x00, 0x17, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x05, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+  0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x02,
+  0xFF, 0xFF, 0x05, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00,
+  0x00, 0x17, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+  0x02, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x04,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x02,
+  0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x02, 0x00,
+  0x00, 0x02, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+  0x7F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x04,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x04, 0x00, 0x00,
+  0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x05,
+  0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x05, 0x00,
+  0x00, 0x05, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+  0x06, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x68, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x7F, 0x00, 0x00, 0x69, 0x00, 0x00, 0x05, 0x07, 0xE0,
+  0x7F, 0x00, 0x00, 0x69, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x19, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x7F,
+  0x00, 0x00, 0x49, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x19, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x7F, 0x00,
+  0x00, 0x39, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x09, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x19, 0x00, 0x00,
+  0x05, 0x07, 0xE0, 0x7F, 0x00, 0x00, 0x39, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x09, 0x00, 0x00, 0x05,
+  0x07, 0xE0, 0x19, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x67, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0x1F, 0x00,
+  0x00, 0x05, 0x07, 0xE0, 0x09, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x09, 0x00, 0x00, 0x05, 0x07, 0xE0,
+  0x09, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x21, 0x00, 0x00, 0x31, 0xFF, 0xFF, 0x13, 0x00, 0x00, 0x31,
+  0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x09, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x09, 0x00,
+  0x00, 0x05, 0x07, 0xE0, 0x09, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x21, 0x00, 0x00, 0x31, 0xFF, 0xFF,
+  0x65, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x09, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x09, 0x00, 0x00, 0x05,
+  0x07, 0xE0, 0x09, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x7F, 0x00, 0x00, 0x39, 0x00, 0x00, 0x05, 0x07,
+  0xE0, 0x09, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x09, 0x00, 0x00, 0x05, 0x07, 0xE0, 0x09, 0x00, 0x00,
+  0x05, 0x07, 0xE0, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00,
+  0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x6D, 0x00, 0x00,
+};
+static const image_module::Image SPLASH = { 240, 135, sizeof(SPLASH_DATA), SPLASH_DATA };
+
+} // namespace images
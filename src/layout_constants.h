@@ -36,3 +36,16 @@
 // LED/bar segment counts
 #define SETUP_BATTERY_SECTIONS    5   // battery screen
 #define SETUP_LED_SECTIONS        4   // LED screens (level + brightness)
+
+// ==============================
+// Layout: Play screen
+// ==============================
+
+// Status icons (images/icons.h), right-aligned along the top edge
+#define PLAY_STATUS_Y         2    // top of the 20 px icon row
+#define PLAY_STATUS_GAP       6
+
+// Fader pickup arrows: one per fader column along the bottom edge
+#define PLAY_PICKUP_Y         113
+#define PLAY_PICKUP_H         18
+#define PLAY_PICKUP_W         14   // arrow base width
@@ -0,0 +1,203 @@
+// =============================
+// File: src/midi_ble.cpp
+// =============================
+#include "midi_ble.h"
+#include "ble_midi_packet.h"
+#include "settings_module.h"
+#include "boot_profile.h"
+
+#ifndef MIDI_BLE_ENABLE
+#define MIDI_BLE_ENABLE 1
+#endif
+
+#if MIDI_BLE_ENABLE
+#include <BLEDevice.h>
+#include <BLEServer.h>
+#include <BLEUtils.h>
+#include <BLE2902.h>
+#endif
+
+namespace {
+  static constexpr const char* DEVICE_NAME  = "deep control";
+  static constexpr const char* SERVICE_UUID = "03B80E5A-EDE8-4B33-A751-6CE34EC4C700";
+  static constexpr const char* CHAR_UUID    = "7772E5DB-3868-4112-A1A9-F2669D106BF3";
+
+  // Connection interval request, 1.25 ms units
+  static constexpr uint16_t CONN_MIN_UNITS    = 6;     // 7.5 ms
+  static constexpr uint16_t CONN_MAX_UNITS    = 12;    // 15 ms
+  static constexpr uint16_t CONN_TIMEOUT_10MS = 200;   // 2 s supervision timeout
+
+  static ble_midi_packet::Packetizer s_pk;
+  static uint32_t s_firstUs   = 0;      // enqueue time of the oldest message in s_pk
+  static uint32_t s_enqSumUs  = 0;      // sum of enqueue times in s_pk (wraps; differences stay valid)
+  static uint32_t s_lastFlushUs = 0;
+  static uint16_t s_lastTs    = 0;      // 13-bit timestamp of the newest message in s_pk
+  static uint8_t  s_channel   = 1;      // 1..16, follows settings
+  static bool     s_begun     = false;
+
+  static midi_ble::Stats s_stats = {};
+
+  // Written by the BLE host task, consumed in update()
+  static volatile bool     s_connected    = false;
+  static volatile uint16_t s_sessions     = 0;
+  static volatile bool     s_reqParams    = false;
+  static volatile bool     s_readvertise  = false;
+  static volatile uint16_t s_intervalUnits = CONN_MAX_UNITS;
+  static volatile uint16_t s_mtu          = 23;
+
+#if MIDI_BLE_ENABLE
+  static BLEServer*         s_server = nullptr;
+  static BLECharacteristic* s_char   = nullptr;
+  static esp_bd_addr_t      s_peer;
+
+  class ServerCallbacks : public BLEServerCallbacks {
+    void onConnect(BLEServer*, esp_ble_gatts_cb_param_t* param) override {
+      memcpy(s_peer, param->connect.remote_bda, sizeof(s_peer));
+      s_intervalUnits = param->connect.conn_params.interval;
+      s_mtu = 23;
+      ++s_sessions;
+      s_connected = true;
+      s_reqParams = true;
+    }
+    void onDisconnect(BLEServer*) override {
+      s_connected = false;
+      s_readvertise = true;
+    }
+    void onMtuChanged(BLEServer*, esp_ble_gatts_cb_param_t* param) override {
+      s_mtu = param->mtu.mtu;
+    }
+  };
+  static ServerCallbacks s_callbacks;
+
+  // The interval the central actually granted arrives as a GAP event
+  void onGap(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param) {
+    if (event == ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT && param->update_conn_params.status == 0)
+      s_intervalUnits = param->update_conn_params.conn_int;
+  }
+#endif
+
+  inline uint32_t intervalUs() { return (uint32_t)s_intervalUnits * 1250UL; }
+
+  void flush(bool early) {
+    if (s_pk.empty()) return;
+#if MIDI_BLE_ENABLE
+    s_char->setValue(s_pk.buf, s_pk.len);
+    s_char->notify();
+#endif
+    const uint32_t now = micros();
+    const uint32_t oldest = now - s_firstUs;
+    ++s_stats.notifications;
+    s_stats.messages += s_pk.msgs;
+    s_stats.bytes += s_pk.len;
+    if (s_pk.msgs > s_stats.maxPerNotify) s_stats.maxPerNotify = s_pk.msgs;
+    s_stats.latencySumUs += now * s_pk.msgs - s_enqSumUs;
+    if (oldest > s_stats.latencyMaxUs) s_stats.latencyMaxUs = oldest;
+    if (early) ++s_stats.earlyFlushes;
+    s_pk.reset();
+    s_lastFlushUs = now;
+  }
+
+  void onSettingChanged(settings_module::Field, uint8_t) {
+    s_channel = settings_module::getBleMidiChannel();
+  }
+}
+
+void midi_ble::begin() {
+  if (s_begun) return;
+  s_begun = true;
+  s_channel = settings_module::getBleMidiChannel();
+  settings_module::subscribe(settings_module::maskOf(settings_module::Field::BleChannel), onSettingChanged);
+#if MIDI_BLE_ENABLE
+  BLEDevice::init(DEVICE_NAME);
+  BLEDevice::setMTU(ble_midi_packet::MAX_PAYLOAD + 3);
+  BLEDevice::setCustomGapHandler(onGap);
+  s_server = BLEDevice::createServer();
+  s_server->setCallbacks(&s_callbacks);
+  BLEService* svc = s_server->createService(SERVICE_UUID);
+  s_char = svc->createCharacteristic(CHAR_UUID,
+             BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_WRITE_NR |
+             BLECharacteristic::PROPERTY_NOTIFY);
+  s_char->addDescriptor(new BLE2902());
+  svc->start();
+  BLEAdvertising* adv = BLEDevice::getAdvertising();
+  adv->addServiceUUID(SERVICE_UUID);
+  adv->setScanResponse(true);
+  BLEDevice::startAdvertising();
+  boot_profile::mark(boot_profile::Milestone::BleAdvertising);
+#endif
+}
+
+void midi_ble::update() {
+  if (!s_begun) return;
+#if MIDI_BLE_ENABLE
+  if (s_reqParams) {
+    s_reqParams = false;
+    s_server->updateConnParams(s_peer, CONN_MIN_UNITS, CONN_MAX_UNITS, 0, CONN_TIMEOUT_10MS);
+  }
+  if (s_readvertise) {
+    s_readvertise = false;
+    s_pk.reset();
+    BLEDevice::startAdvertising();
+  }
+#endif
+  // Cap follows the MTU; a smaller cap only applies to the next packet
+  const uint16_t cap = s_mtu > 3 ? s_mtu - 3 : 20;
+  s_pk.cap = cap < ble_midi_packet::MAX_PAYLOAD ? (uint8_t)cap : ble_midi_packet::MAX_PAYLOAD;
+  if (!s_pk.empty() && micros() - s_lastFlushUs >= intervalUs()) flush(false);
+}
+
+bool midi_ble::send(uint8_t status, uint8_t data1, uint8_t data2) {
+  return sendAt((uint16_t)millis(), status, data1, data2);
+}
+
+bool midi_ble::sendAt(uint16_t tsMs, uint8_t status, uint8_t data1, uint8_t data2) {
+  if (!s_begun || !s_connected) return false;
+  const uint32_t now = micros();
+  uint16_t ts = tsMs & 0x1FFF;
+  // Timestamps in a packet must not go backwards; an older one rides at the newest
+  if (!s_pk.empty() && ts != s_lastTs && ((s_lastTs - ts) & 0x1FFF) < 0x1000) ts = s_lastTs;
+  if (s_pk.empty() && now - s_lastFlushUs >= intervalUs()) s_lastFlushUs = now;   // idle link: interval starts now
+  if (!s_pk.add(ts, status, data1, data2)) {
+    flush(true);
+    if (!s_pk.add(ts, status, data1, data2)) return false;
+  }
+  if (s_pk.msgs == 1) { s_firstUs = now; s_enqSumUs = 0; }
+  s_enqSumUs += now;
+  s_lastTs = ts;
+  return true;
+}
+
+bool midi_ble::controlChange(uint8_t cc, uint8_t value) {
+  return send((uint8_t)(0xB0 | ((s_channel - 1) & 0x0F)), cc, value);
+}
+
+bool midi_ble::programChange(uint8_t program) {
+  return send((uint8_t)(0xC0 | ((s_channel - 1) & 0x0F)), program);
+}
+
+uint8_t midi_ble::channel() { return s_channel; }
+
+bool midi_ble::connected() { return s_connected; }
+
+uint16_t midi_ble::sessions() { return s_sessions; }
+
+uint8_t midi_ble::room() {
+  if (!s_begun || !s_connected) return 0;
+  const uint8_t used = s_pk.len ? s_pk.len : 1;   // header byte comes with the first message
+  return s_pk.cap > used ? (uint8_t)(s_pk.cap - used) : 0;
+}
+
+const midi_ble::Stats& midi_ble::stats() { return s_stats; }
+
+void midi_ble::printStats(Print& out) {
+  out.print(F("[midi_ble] ")); out.print(s_connected ? F("connected") : F("idle"));
+  out.print(F(" interval=")); out.print(intervalUs() / 1000.0f, 2); out.print(F("ms"));
+  out.print(F(" mtu=")); out.print(s_mtu);
+  out.print(F(" notifies=")); out.print(s_stats.notifications);
+  out.print(F(" msgs=")); out.print(s_stats.messages);
+  out.print(F(" msgs/notify avg=")); out.print(s_stats.notifications ? (float)s_stats.messages / s_stats.notifications : 0.0f, 2);
+  out.print(F(" max=")); out.print(s_stats.maxPerNotify);
+  out.print(F(" early=")); out.print(s_stats.earlyFlushes);
+  out.print(F(" enqueue->notify avg/max=")); out.print(s_stats.messages ? s_stats.latencySumUs / 1000.0f / s_stats.messages : 0.0f, 2);
+  out.print('/'); out.print(s_stats.latencyMaxUs / 1000.0f, 2); out.println(F("ms"));
+}
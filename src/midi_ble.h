@@ -0,0 +1,41 @@
+// =============================
+// File: src/midi_ble.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// BLE-MIDI peripheral (GATT service 03B80E5A-...). Messages are packed into
+// one BLE-MIDI packet (ble_midi_packet) and notified once per connection
+// interval, or earlier when the packet is full or its timestamp high bits
+// roll over. On connect a 7.5-15 ms interval is requested. Nothing is queued
+// while no central is connected; send() then returns false.
+namespace midi_ble {
+  void begin();
+  void update();
+
+  bool send(uint8_t status, uint8_t data1, uint8_t data2 = 0);
+  // As send(), stamped with an earlier millis() (e.g. taken in an ISR) so
+  // the receiver sees when it happened rather than when it was notified
+  bool sendAt(uint16_t tsMs, uint8_t status, uint8_t data1 = 0, uint8_t data2 = 0);
+
+  // On the BLE channel from settings_module (1..16)
+  bool controlChange(uint8_t cc, uint8_t value);
+  bool programChange(uint8_t program);
+  uint8_t channel();       // 1..16
+
+  bool connected();
+  uint16_t sessions();    // connections so far; a change means a receiver with unknown state
+  uint8_t room();         // payload bytes left in the packet being built (0 when idle)
+
+  struct Stats {
+    uint32_t notifications;
+    uint32_t messages;
+    uint32_t bytes;            // payload bytes notified
+    uint8_t  maxPerNotify;
+    uint32_t latencySumUs;     // enqueue -> notify, summed over messages
+    uint32_t latencyMaxUs;
+    uint32_t earlyFlushes;     // packet full / timestamp rollover before the interval was up
+  };
+  const Stats& stats();
+  void printStats(Print& out = Serial);
+}
@@ -0,0 +1,146 @@
+// =============================
+// File: src/midi_din.cpp
+// =============================
+#include "midi_din.h"
+#include "pinmap_module.h"
+#include "settings_module.h"
+#include "boot_profile.h"
+#include "driver/uart.h"
+#include "esp_intr_alloc.h"
+#include "hal/uart_ll.h"
+#include "soc/soc_caps.h"
+
+namespace {
+  static_assert((midi_din::RING_BYTES & (midi_din::RING_BYTES - 1)) == 0, "RING_BYTES must be a power of two");
+  static constexpr uint16_t MASK = midi_din::RING_BYTES - 1;
+  static constexpr uart_port_t UART_NUM = UART_NUM_1;
+  static constexpr int      RX_BYTES = SOC_UART_FIFO_LEN * 2;   // unused, but the driver wants one
+  static_assert((1 << midi_din::ISR_LEVEL) == ESP_INTR_FLAG_LEVEL1, "ISR_LEVEL and the UART flag must agree");
+
+  static uint8_t  s_ring[midi_din::RING_BYTES];
+  static uint16_t s_head = 0;     // next write
+  static uint16_t s_tail = 0;     // next byte for the UART
+  static bool     s_begun = false;
+  static uint8_t  s_channel = 1;  // 1..16, follows settings
+
+  static midi_din::RunningStatus s_rs;
+  static midi_din::Stats         s_stats = {};
+
+  inline uint16_t used() { return (uint16_t)(s_head - s_tail) & MASK; }
+  inline uint16_t room() { return MASK - used(); }   // one slot stays empty
+
+  inline int driverRoom() {
+    size_t room = 0;
+    uart_get_tx_buffer_free_size(UART_NUM, &room);
+    return (int)room;
+  }
+
+  // Hand as much as the driver's TX buffer takes; never waits
+  void pump() {
+    int space = driverRoom();
+    while (space > 0 && s_tail != s_head) {
+      // Contiguous run up to the ring end or the driver's room
+      uint16_t n = (s_head > s_tail) ? (uint16_t)(s_head - s_tail) : (uint16_t)(midi_din::RING_BYTES - s_tail);
+      if (n > space) n = (uint16_t)space;
+      const int w = uart_write_bytes(UART_NUM, &s_ring[s_tail], n);
+      if (w <= 0) break;
+      s_tail = (uint16_t)(s_tail + w) & MASK;
+      space -= w;
+    }
+  }
+
+  void onSettingChanged(settings_module::Field, uint8_t) {
+    s_channel = settings_module::getDinMidiChannel();
+  }
+}
+
+// The driver is installed directly rather than through Serial1, whose
+// begin() leaves the interrupt level to the allocator: realtimeFromIsr()
+// needs it pinned to ISR_LEVEL.
+void midi_din::begin() {
+  if (s_begun) return;
+  uart_config_t cfg = {};
+  cfg.baud_rate = BAUD;
+  cfg.data_bits = UART_DATA_8_BITS;
+  cfg.parity    = UART_PARITY_DISABLE;
+  cfg.stop_bits = UART_STOP_BITS_1;
+  cfg.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+  cfg.source_clk = UART_SCLK_DEFAULT;
+  // TX ring of RING_BYTES, drained into the FIFO by the UART TX interrupt
+  if (uart_driver_install(UART_NUM, RX_BYTES, RING_BYTES, 0, nullptr, ESP_INTR_FLAG_LEVEL1) != ESP_OK) return;
+  uart_param_config(UART_NUM, &cfg);
+  uart_set_pin(UART_NUM, pinmap::MIDI_TX, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+  s_begun = true;
+  s_channel = settings_module::getDinMidiChannel();
+  settings_module::subscribe(settings_module::maskOf(settings_module::Field::DinChannel), onSettingChanged);
+  boot_profile::mark(boot_profile::Milestone::MidiReady);
+}
+
+void midi_din::update() {
+  if (s_begun) pump();
+}
+
+bool midi_din::send(uint8_t status, uint8_t data1, uint8_t data2) {
+  uint8_t bytes[3];
+  RunningStatus rs = s_rs;   // commit only if the message fits
+  const uint8_t n = rs.encode(status, data1, data2, millis(), bytes);
+  if (n > room()) { ++s_stats.dropped; return false; }
+  s_rs = rs;
+
+  for (uint8_t i = 0; i < n; ++i) { s_ring[s_head] = bytes[i]; s_head = (s_head + 1) & MASK; }
+  ++s_stats.messages;
+  s_stats.bytes += n;
+  s_stats.statusSkipped += messageLength(status) - n;
+  if (used() > s_stats.maxBacklog) s_stats.maxBacklog = used();
+
+  if (s_begun) pump();
+  return true;
+}
+
+bool midi_din::controlChange(uint8_t cc, uint8_t value) {
+  return send((uint8_t)(0xB0 | ((s_channel - 1) & 0x0F)), cc, value);
+}
+
+bool midi_din::programChange(uint8_t program) {
+  return send((uint8_t)(0xC0 | ((s_channel - 1) & 0x0F)), program);
+}
+
+uint8_t midi_din::channel() { return s_channel; }
+
+// The UART driver's TX interrupt refills the same FIFO from free space it
+// has just read. Both it and the clock timer (tempo_module) are allocated
+// from loop()'s core at ISR_LEVEL, and an interrupt never preempts one of
+// its own level, so the two never run inside each other's refill.
+bool IRAM_ATTR midi_din::realtimeFromIsr(const uint8_t* bytes, uint8_t n) {
+  if (!s_begun) return false;
+  uart_dev_t* hw = UART_LL_GET_HW(UART_NUM);
+  if (uart_ll_get_txfifo_len(hw) < n) return false;
+  uart_ll_write_txfifo(hw, bytes, n);
+  return true;
+}
+
+uint16_t midi_din::backlog() { return used(); }
+
+// The driver's TX interrupt moves its buffer into the hardware FIFO almost at
+// once, so most bytes not yet on the wire sit in the FIFO, not the driver.
+uint16_t midi_din::inFlight() {
+  if (!s_begun) return used();
+  const int free = driverRoom();
+  const uint16_t driver = free >= (int)RING_BYTES ? 0 : (uint16_t)(RING_BYTES - free);
+  const uint16_t fifo = (uint16_t)(SOC_UART_FIFO_LEN - uart_ll_get_txfifo_len(UART_LL_GET_HW(UART_NUM)));
+  return used() + driver + fifo;
+}
+
+const midi_din::Stats& midi_din::stats() { return s_stats; }
+
+void midi_din::printStats(Print& out) {
+  out.print(F("[midi_din] msgs=")); out.print(s_stats.messages);
+  out.print(F(" bytes=")); out.print(s_stats.bytes);
+  out.print(F(" status skipped=")); out.print(s_stats.statusSkipped);
+  if (s_stats.bytes + s_stats.statusSkipped) {
+    out.print(F(" (")); out.print(100.0f * s_stats.statusSkipped / (s_stats.bytes + s_stats.statusSkipped), 1); out.print(F("%)"));
+  }
+  out.print(F(" dropped=")); out.print(s_stats.dropped);
+  out.print(F(" backlog=")); out.print(used());
+  out.print(F(" max=")); out.println(s_stats.maxBacklog);
+}
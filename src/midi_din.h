@@ -0,0 +1,87 @@
+// =============================
+// File: src/midi_din.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// DIN MIDI out on UART1 (pinmap::MIDI_TX). send() never blocks: messages go
+// into a fixed byte ring that update() (and send() itself) hand to the UART
+// driver only as far as its interrupt-drained TX buffer has room. Repeated
+// channel status bytes are dropped (running status), refreshed at least every
+// RS_REFRESH_MS so a receiver that joins late still locks on.
+namespace midi_din {
+  constexpr uint32_t BAUD          = 31250;
+  constexpr uint32_t BYTE_US       = 320;    // 10 bits on the wire at 31.25 kbaud
+  constexpr uint16_t RING_BYTES    = 256;    // power of two
+  constexpr uint16_t RS_REFRESH_MS = 300;
+  constexpr int      ISR_LEVEL     = 1;      // UART TX and clock timer interrupts (see realtimeFromIsr)
+
+  void begin();
+  void update();
+
+  // Raw channel/system message; length follows the status byte.
+  // Returns false (and counts a drop) when the ring cannot take all of it.
+  bool send(uint8_t status, uint8_t data1, uint8_t data2 = 0);
+
+  // On the DIN channel from settings_module (1..16)
+  bool controlChange(uint8_t cc, uint8_t value);
+  bool programChange(uint8_t program);
+  uint8_t channel();       // 1..16
+
+  // Realtime bytes (clock, start/stop) straight into the UART TX FIFO, for a
+  // timer ISR. MIDI lets realtime bytes sit between any two bytes, so they
+  // overtake the ring and the driver buffer; only what is already in the
+  // hardware FIFO goes first. false before begin() or when the FIFO is full.
+  // Only safe from an interrupt at ISR_LEVEL on the core that ran begin().
+  bool realtimeFromIsr(const uint8_t* bytes, uint8_t n);
+
+  uint16_t backlog();     // bytes queued, not yet handed to the UART
+  uint16_t inFlight();    // backlog plus what the UART driver and TX FIFO still hold
+
+  struct Stats {
+    uint32_t messages;
+    uint32_t bytes;          // bytes queued for the wire
+    uint32_t statusSkipped;  // status bytes saved by running status
+    uint32_t dropped;        // messages refused because the ring was full
+    uint16_t maxBacklog;
+  };
+  const Stats& stats();
+  void printStats(Print& out = Serial);
+
+  // Message length in bytes incl. status (1..3)
+  inline uint8_t messageLength(uint8_t status) {
+    switch (status & 0xF0) {
+      case 0xC0: case 0xD0: return 2;   // program change, channel pressure
+      case 0xF0:
+        if (status == 0xF1 || status == 0xF3) return 2;
+        if (status == 0xF2) return 3;
+        return 1;                       // realtime / tune request
+      default:   return 3;
+    }
+  }
+
+  // Running-status encoder; header-only so the wire-time simulator can use it
+  struct RunningStatus {
+    uint8_t  last   = 0;      // 0 = no status in force
+    uint32_t lastMs = 0;      // when `last` was last sent in full
+
+    // Writes the bytes to send into out[3]; returns their count.
+    uint8_t encode(uint8_t status, uint8_t d1, uint8_t d2, uint32_t nowMs, uint8_t* out) {
+      const uint8_t len = messageLength(status);
+      uint8_t n = 0;
+      if (status >= 0xF8) { out[0] = status; return 1; }   // realtime: leaves running status alone
+      bool full = true;
+      if (status >= 0xF0) {
+        last = 0;                                          // system common cancels it
+      } else if (status == last && nowMs - lastMs < RS_REFRESH_MS) {
+        full = false;
+      } else {
+        last = status; lastMs = nowMs;
+      }
+      if (full) out[n++] = status;
+      if (len > 1) out[n++] = d1 & 0x7F;
+      if (len > 2) out[n++] = d2 & 0x7F;
+      return n;
+    }
+  };
+}
@@ -0,0 +1,78 @@
+// =============================
+// File: src/midi_monitor.cpp
+// =============================
+#include "midi_monitor.h"
+#include <Adafruit_ST77XX.h>
+#include "display_module.h"
+#include "layout_constants.h"
+
+using display_module::tft;
+
+namespace {
+  // Column width must divide SCREEN_W so the exposed strip never wraps
+  static constexpr int16_t COL_W   = 4;
+  static constexpr int16_t BAR_W   = COL_W - 1;   // 1px gap between messages
+  static constexpr int16_t TICK_H  = 4;           // channel tick at the top of each column
+  static constexpr int16_t BAR_MAX = SCREEN_H - TICK_H - 2;
+
+  static bool     s_active = false;
+  static uint32_t s_pushed = 0;
+
+  inline uint16_t colourFor(uint8_t status) {
+    switch (status & 0xF0) {
+      case 0xB0: return ST77XX_GREEN;   // control change
+      case 0xC0: return ST77XX_RED;     // program change
+      case 0x90: return ST77XX_CYAN;    // note on
+      default:   return ST77XX_WHITE;
+    }
+  }
+
+  // Value shown as the bar: PC has a single data byte
+  inline uint8_t valueFor(uint8_t status, uint8_t d1, uint8_t d2) {
+    return ((status & 0xF0) == 0xC0) ? d1 : d2;
+  }
+}
+
+void midi_monitor::show() {
+  tft.fillScreen(ST77XX_BLACK);
+  display_module::scrollDefine(0, 0);
+  s_active = true;
+}
+
+void midi_monitor::hide() {
+  if (!s_active) return;
+  display_module::scrollReset();
+  tft.fillScreen(ST77XX_BLACK);
+  s_active = false;
+}
+
+bool midi_monitor::active() { return s_active; }
+
+void midi_monitor::push(uint8_t status, uint8_t data1, uint8_t data2) {
+  if (!s_active) return;
+  const int16_t x = display_module::scrollStep(COL_W);
+  if (x < 0) return;
+
+  const uint8_t  v    = valueFor(status, data1, data2) & 0x7F;
+  const int16_t  barH = (int16_t)(((int32_t)BAR_MAX * v) / 127);
+  const uint16_t col  = colourFor(status);
+
+  // Paint the whole exposed strip exactly once: background, tick, bar
+  tft.fillRect(x, 0, BAR_W, TICK_H, (status & 0x01) ? ST77XX_YELLOW : ST77XX_MAGENTA); // odd/even channel
+  tft.drawFastVLine(x + BAR_W, 0, TICK_H, ST77XX_BLACK);
+  tft.fillRect(x, TICK_H, COL_W, SCREEN_H - TICK_H - barH, ST77XX_BLACK);
+  if (barH > 0) {
+    tft.fillRect(x, SCREEN_H - barH, BAR_W, barH, col);
+    tft.drawFastVLine(x + BAR_W, SCREEN_H - barH, barH, ST77XX_BLACK);
+  }
+  ++s_pushed;
+}
+
+void midi_monitor::printStats(Stream& out) {
+  const uint32_t full = (uint32_t)SCREEN_W * SCREEN_H;
+  out.print(F("[midi_monitor] msgs=")); out.print(s_pushed);
+  out.print(F(" steps=")); out.print(display_module::scrollSteps());
+  out.print(F(" px/step=")); out.print(display_module::scrollPixelsLastStep());
+  out.print(F(" (full redraw=")); out.print(full);
+  out.print(F(") total px=")); out.println(display_module::scrollPixelsTotal());
+}
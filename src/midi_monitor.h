@@ -0,0 +1,18 @@
+// =============================
+// File: src/midi_monitor.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// Scrolling MIDI activity strip. Each message enters at the right edge as one
+// narrow column (bar height = data value) while the hardware scroll moves the
+// history left, so a step pushes one column instead of the whole screen.
+namespace midi_monitor {
+  void show();                                         // take over the screen
+  void hide();                                         // restore addressing; caller redraws
+  bool active();
+
+  void push(uint8_t status, uint8_t data1, uint8_t data2); // log one outgoing message
+
+  void printStats(Stream& out = Serial);               // pixels pushed per step vs full redraw
+}
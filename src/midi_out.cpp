@@ -0,0 +1,123 @@
+// =============================
+// File: src/midi_out.cpp
+// =============================
+#include "midi_out.h"
+#include "midi_din.h"
+#include "midi_ble.h"
+#include "midi_monitor.h"
+
+using midi_out::Priority;
+using midi_out::SINK_DIN;
+using midi_out::SINK_BLE;
+
+namespace {
+  static constexpr uint8_t BLE_MSG_MAX = 4;   // timestamp + status + 2 data
+
+  static midi_out::Coalescer s_co;
+
+  inline uint8_t statusFor(uint8_t kind, uint8_t channel, uint8_t sinkChannel) {
+    if (kind >= 0xF0) return kind;
+    return (uint8_t)(kind | (((channel ? channel : sinkChannel) - 1) & 0x0F));
+  }
+
+  // Only faders are held to the budget (a group may start while there is room
+  // for one message); Program/Stomp go at the next boundary. A group cut
+  // short by a full ring is resent whole.
+  bool sendDin(Priority prio, uint8_t channel, const midi_out::Msg* m, uint8_t n) {
+    if (prio == Priority::Fader && midi_din::inFlight() + 3 > midi_out::DIN_BUDGET_BYTES) return false;
+    for (uint8_t i = 0; i < n; ++i) {
+      const uint8_t status = statusFor(m[i].kind, channel, midi_din::channel());
+      if (!midi_din::send(status, m[i].d1, m[i].d2)) return false;
+      midi_monitor::push(status, m[i].d1, m[i].d2);
+    }
+    return true;
+  }
+
+  // A full packet makes midi_ble notify early, which Program/Stomp accept
+  bool sendBle(Priority prio, uint8_t channel, const midi_out::Msg* m, uint8_t n) {
+    if (prio == Priority::Fader && midi_ble::room() < BLE_MSG_MAX * n) return false;
+    for (uint8_t i = 0; i < n; ++i) {
+      if (!midi_ble::send(statusFor(m[i].kind, channel, midi_ble::channel()), m[i].d1, m[i].d2)) return false;
+    }
+    return true;
+  }
+
+  inline uint8_t liveSinks() {
+    return (uint8_t)((1u << SINK_DIN) | (midi_ble::connected() ? (1u << SINK_BLE) : 0));
+  }
+
+  void drain() {
+    const uint32_t now = micros();
+    s_co.drain(SINK_DIN, now, sendDin);
+    if (midi_ble::connected()) s_co.drain(SINK_BLE, now, sendBle);
+    else s_co.forget(SINK_BLE);
+  }
+
+  bool coalesce(uint8_t channel, midi_out::Kind kind, uint16_t num, uint16_t value, Priority prio) {
+    if (!s_co.put(channel, kind, num, value, prio, liveSinks(), micros())) return false;
+    drain();   // an idle link sends at once
+    return true;
+  }
+
+  bool urgent(uint8_t channel, uint8_t kind, uint8_t d1, uint8_t d2) {
+    if (!s_co.putUrgent(channel, kind, d1 & 0x7F, d2 & 0x7F, liveSinks(), micros())) return false;
+    drain();
+    return true;
+  }
+}
+
+void midi_out::update() {
+  drain();
+}
+
+bool midi_out::controlChange(uint8_t cc, uint8_t value, Priority prio, uint8_t channel) {
+  if (prio == Priority::Program) return urgent(channel, 0xB0, cc, value);
+  return coalesce(channel, midi_out::Kind::Cc7, cc & 0x7F, value & 0x7F, prio);
+}
+
+bool midi_out::controlChange14(uint8_t cc, uint16_t value, Priority prio, uint8_t channel) {
+  if (cc > 31) return false;
+  return coalesce(channel, midi_out::Kind::Cc14, cc, value & 0x3FFF, prio);
+}
+
+bool midi_out::nrpn(uint16_t param, uint16_t value, Priority prio, uint8_t channel) {
+  return coalesce(channel, midi_out::Kind::Nrpn, param & 0x3FFF, value & 0x3FFF, prio);
+}
+
+bool midi_out::programChange(uint8_t program, uint8_t channel) {
+  return urgent(channel, 0xC0, program, 0);
+}
+
+bool midi_out::bankSelect(uint8_t msb, uint8_t channel) {
+  return urgent(channel, 0xB0, 0, msb);
+}
+
+bool midi_out::send(uint8_t status, uint8_t data1, uint8_t data2) {
+  if (status >= 0xF0) return urgent(0, status, data1, data2);
+  return urgent((uint8_t)((status & 0x0F) + 1), (uint8_t)(status & 0xF0), data1, data2);
+}
+
+void midi_out::resync() { s_co.resync(); }
+
+const midi_out::Stats& midi_out::stats() { return s_co.stats; }
+
+void midi_out::printStats(Print& out) {
+  const Stats& s = s_co.stats;
+  out.print(F("[midi_out] cc writes=")); out.print(s.writes);
+  out.print(F(" coalesced=")); out.print(s.coalesced);
+  out.print(F(" dropped=")); out.print(s.dropped);
+  out.print(F(" msb skipped=")); out.print(s.msbSkipped);
+  out.print(F(" slots=")); out.print(s_co.count); out.print('/'); out.println(SLOTS);
+  static const char* const SINK_NAMES[SINKS]    = { "din", "ble" };
+  static const char* const CLASS_NAMES[CLASSES] = { "program", "stomp", "fader" };
+  for (uint8_t k = 0; k < SINKS; ++k) {
+    out.print(F("  ")); out.print(SINK_NAMES[k]);
+    out.print(F(" owed=")); out.println(s_co.owed(k));
+    for (uint8_t c = 0; c < CLASSES; ++c) {
+      out.print(F("    ")); out.print(CLASS_NAMES[c]);
+      out.print(F(" sent=")); out.print(s.sent[k][c]);
+      out.print(F(" lag avg/max=")); out.print(s.sent[k][c] ? s.lagSumUs[k][c] / 1000.0f / s.sent[k][c] : 0.0f, 2);
+      out.print('/'); out.print(s.lagMaxUs[k][c] / 1000.0f, 2); out.println(F("ms"));
+    }
+  }
+}
@@ -0,0 +1,246 @@
+// =============================
+// File: src/midi_out.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// Single entry point for outgoing MIDI, fanned out to the DIN and BLE sinks.
+// Messages are scheduled in priority classes; each drain pass serves every
+// class before the next one down, so a program change queued behind a fader
+// sweep goes out at the next message boundary:
+//   Program  PC, bank select, raw messages: in order, never coalesced, and
+//            not held back by the fader budget
+//   Stomp    switch CCs: coalesced, drained before faders
+//   Fader    continuous CCs: one slot per (channel, CC) - or per 14-bit CC
+//            pair / NRPN parameter - a newer value overwrites the unsent
+//            one, drained round-robin only as far as the sink's byte budget
+//            allows, so a sweep faster than the link costs intermediate
+//            values rather than lag
+// Bytes already handed to a sink are not recalled; DIN_BUDGET_BYTES bounds
+// how many of those a program change can find ahead of it.
+namespace midi_out {
+  enum class Priority : uint8_t { Program, Stomp, Fader };
+
+  constexpr uint8_t  CLASSES          = 3;
+  constexpr uint8_t  SLOTS            = 32;
+  constexpr uint8_t  URGENT_SLOTS     = 16;   // Program-class queue
+  constexpr uint8_t  SINK_DIN         = 0;
+  constexpr uint8_t  SINK_BLE         = 1;
+  constexpr uint8_t  SINKS            = 2;
+  constexpr uint16_t DIN_BUDGET_BYTES = 8;    // fader bytes allowed in flight on DIN (~2.5 ms of wire)
+
+  void update();          // sinks are their own modules; nothing to begin
+
+  // channel 1..16, or 0 = each sink's channel from settings
+  bool controlChange(uint8_t cc, uint8_t value, Priority prio = Priority::Fader, uint8_t channel = 0);
+  // 14-bit value 0..16383: CC cc (MSB) + cc + 32 (LSB), cc 0..31
+  bool controlChange14(uint8_t cc, uint16_t value, Priority prio = Priority::Fader, uint8_t channel = 0);
+  // 14-bit value to NRPN parameter 0..16383 (CC 99/98, data entry 6/38)
+  bool nrpn(uint16_t param, uint16_t value, Priority prio = Priority::Fader, uint8_t channel = 0);
+  bool programChange(uint8_t program, uint8_t channel = 0);
+  bool bankSelect(uint8_t msb, uint8_t channel = 0);   // CC0
+
+  // Any other message, Program class (status carries its channel)
+  bool send(uint8_t status, uint8_t data1, uint8_t data2 = 0);
+
+  // Forget what the receivers are known to hold, so the next 14-bit / NRPN
+  // values go out whole (MSB and parameter select included)
+  void resync();
+
+  struct Stats {
+    uint32_t writes;                 // coalesced-class writes
+    uint32_t coalesced;              // values overwritten before a sink sent them
+    uint32_t dropped;                // no free slot / urgent queue full
+    uint32_t msbSkipped;             // 14-bit / NRPN messages left out because the receiver has them
+    uint32_t sent[SINKS][CLASSES];
+    uint32_t lagSumUs[SINKS][CLASSES];   // first unsent write -> handed to the sink, per send
+    uint32_t lagMaxUs[SINKS][CLASSES];
+  };
+  const Stats& stats();
+  void printStats(Print& out = Serial);
+
+  // One wire message; kind is the status with the channel nibble clear
+  // (system messages as is).
+  struct Msg { uint8_t kind, d1, d2; };
+  constexpr uint8_t MAX_GROUP = 4;   // NRPN: 99, 98, 6, 38
+
+  // What a coalesced slot carries
+  enum class Kind : uint8_t { Cc7, Cc14, Nrpn };
+
+  // Slot table, urgent queue and scheduler; header-only so the wire-time
+  // simulator can drive it against a model link.
+  //
+  // drain() offers each due slot or urgent message to
+  // trySend(prio, channel, msgs, n) as one group (channel 0 = the sink's
+  // own). A refusal ends the pass for that sink, so lower classes never
+  // overtake a waiting higher one. Per sink, a slot remembers the MSB it
+  // last sent and the NRPN parameter last selected, and leaves out what the
+  // receiver already has: a 14-bit move within one MSB step costs one CC.
+  struct Coalescer {
+    struct Slot {
+      uint8_t  channel;              // 0 = sink default
+      Kind     kind;
+      uint16_t num;                  // CC, or NRPN parameter (14 bits)
+      uint16_t value;                // 7 or 14 bits per kind
+      uint8_t  dirty;                // one bit per sink still owed `value`
+      Priority prio;
+      uint8_t  sentMsb[SINKS];       // 0xFF = receiver state unknown
+      uint32_t sinceUs[SINKS];       // oldest unsent write per sink
+      uint32_t usedUs;               // last write, for reuse of clean slots
+    };
+    struct Urgent {
+      uint8_t  channel;
+      Msg      msg;
+      uint8_t  owed;                 // sinks still to send it
+      uint32_t atUs;
+    };
+    static constexpr uint32_t NO_PARAM = 0xFFFFFFFFUL;
+
+    Slot     slots[SLOTS] = {};
+    uint8_t  count = 0;              // slots in use
+    uint8_t  cursor[SINKS][CLASSES] = {};   // next slot each sink looks at, per class
+    uint32_t nrpnSel[SINKS] = { NO_PARAM, NO_PARAM };   // channel << 16 | parameter
+    Urgent   urgent[URGENT_SLOTS] = {};
+    uint8_t  uHead = 0, uTail = 0;   // ring; free-running indices
+    Stats    stats = {};
+
+    // false when every slot is owed to some sink and the key is new
+    bool put(uint8_t channel, Kind kind, uint16_t num, uint16_t value, Priority prio, uint8_t sinkMask, uint32_t nowUs) {
+      ++stats.writes;
+      int16_t hit = -1, reuse = -1;
+      for (uint8_t i = 0; i < count; ++i) {
+        const Slot& s = slots[i];
+        if (s.channel == channel && s.kind == kind && s.num == num) { hit = i; break; }
+        if (!s.dirty && (reuse < 0 || (int32_t)(s.usedUs - slots[reuse].usedUs) < 0)) reuse = i;
+      }
+      if (hit < 0) {
+        if (count < SLOTS) hit = count++;
+        else if (reuse >= 0) hit = reuse;
+        else { ++stats.dropped; return false; }
+        Slot& s = slots[hit];
+        s.channel = channel;
+        s.kind = kind;
+        s.num = num;
+        s.dirty = 0;
+        for (uint8_t k = 0; k < SINKS; ++k) s.sentMsb[k] = 0xFF;
+      }
+      Slot& s = slots[hit];
+      if (s.dirty & sinkMask) ++stats.coalesced;
+      for (uint8_t k = 0; k < SINKS; ++k)
+        if ((sinkMask & (1u << k)) && !(s.dirty & (1u << k))) s.sinceUs[k] = nowUs;
+      s.value = value;
+      s.prio = prio;
+      s.dirty |= sinkMask;
+      s.usedUs = nowUs;
+      return true;
+    }
+
+    bool putUrgent(uint8_t channel, uint8_t kind, uint8_t d1, uint8_t d2, uint8_t sinkMask, uint32_t nowUs) {
+      if ((uint8_t)(uHead - uTail) >= URGENT_SLOTS) { ++stats.dropped; return false; }
+      urgent[uHead % URGENT_SLOTS] = { channel, { kind, d1, d2 }, sinkMask, nowUs };
+      ++uHead;
+      return true;
+    }
+
+    template <typename Fn>
+    uint8_t drain(uint8_t sink, uint32_t nowUs, Fn trySend) {
+      const uint8_t bit = (uint8_t)(1u << sink);
+      uint8_t sent = 0;
+
+      for (uint8_t u = uTail; u != uHead; ++u) {
+        Urgent& e = urgent[u % URGENT_SLOTS];
+        if (!(e.owed & bit)) continue;
+        if (!trySend(Priority::Program, e.channel, &e.msg, (uint8_t)1)) return sent;
+        // A raw CC 99/98 re-targets the receiver's NRPN
+        if (e.msg.kind == 0xB0 && (e.msg.d1 == 99 || e.msg.d1 == 98)) nrpnSel[sink] = NO_PARAM;
+        e.owed &= (uint8_t)~bit;
+        account(sink, Priority::Program, nowUs - e.atUs);
+        ++sent;
+      }
+      while (uTail != uHead && !urgent[uTail % URGENT_SLOTS].owed) ++uTail;
+
+      for (uint8_t c = (uint8_t)Priority::Stomp; c < CLASSES; ++c) {
+        uint8_t& cur = cursor[sink][c];
+        const uint8_t start = cur < count ? cur : 0;
+        for (uint8_t n = 0; n < count; ++n) {
+          const uint8_t i = (uint8_t)((start + n) % count);
+          Slot& s = slots[i];
+          if (!(s.dirty & bit) || (uint8_t)s.prio != c) continue;
+          Msg m[MAX_GROUP];
+          const uint8_t len = expand(s, sink, m);
+          if (!trySend(s.prio, s.channel, (const Msg*)m, len)) { cur = i; return sent; }
+          commit(s, sink, len);
+          cur = (uint8_t)((i + 1) % count);
+          s.dirty &= (uint8_t)~bit;
+          account(sink, s.prio, nowUs - s.sinceUs[sink]);
+          ++sent;
+        }
+      }
+      return sent;
+    }
+
+    // Stop owing anything to a sink that went away; its receiver state is unknown
+    void forget(uint8_t sink) {
+      const uint8_t mask = (uint8_t)~(1u << sink);
+      for (uint8_t i = 0; i < count; ++i) { slots[i].dirty &= mask; slots[i].sentMsb[sink] = 0xFF; }
+      for (uint8_t u = uTail; u != uHead; ++u) urgent[u % URGENT_SLOTS].owed &= mask;
+      while (uTail != uHead && !urgent[uTail % URGENT_SLOTS].owed) ++uTail;
+      nrpnSel[sink] = NO_PARAM;
+    }
+
+    void resync() {
+      for (uint8_t i = 0; i < count; ++i)
+        for (uint8_t k = 0; k < SINKS; ++k) slots[i].sentMsb[k] = 0xFF;
+      for (uint8_t k = 0; k < SINKS; ++k) nrpnSel[k] = NO_PARAM;
+    }
+
+    uint8_t owed(uint8_t sink) const {
+      uint8_t n = 0;
+      for (uint8_t i = 0; i < count; ++i) n += (slots[i].dirty >> sink) & 1;
+      for (uint8_t u = uTail; u != uHead; ++u) n += (urgent[u % URGENT_SLOTS].owed >> sink) & 1;
+      return n;
+    }
+
+  private:
+    static uint32_t paramKey(const Slot& s) { return ((uint32_t)s.channel << 16) | s.num; }
+
+    uint8_t expand(const Slot& s, uint8_t sink, Msg* m) {
+      uint8_t n = 0;
+      const uint8_t msb = (uint8_t)((s.value >> 7) & 0x7F), lsb = (uint8_t)(s.value & 0x7F);
+      switch (s.kind) {
+        case Kind::Cc7:
+          m[n++] = { 0xB0, (uint8_t)s.num, (uint8_t)(s.value & 0x7F) };
+          break;
+        case Kind::Cc14:
+          if (s.sentMsb[sink] != msb) m[n++] = { 0xB0, (uint8_t)s.num, msb };
+          m[n++] = { 0xB0, (uint8_t)(s.num + 32), lsb };
+          break;
+        case Kind::Nrpn: {
+          const bool select = nrpnSel[sink] != paramKey(s);
+          if (select) {
+            m[n++] = { 0xB0, 99, (uint8_t)((s.num >> 7) & 0x7F) };
+            m[n++] = { 0xB0, 98, (uint8_t)(s.num & 0x7F) };
+          }
+          if (select || s.sentMsb[sink] != msb) m[n++] = { 0xB0, 6, msb };
+          m[n++] = { 0xB0, 38, lsb };
+          break;
+        }
+      }
+      return n;
+    }
+
+    void commit(Slot& s, uint8_t sink, uint8_t len) {
+      if (s.kind == Kind::Cc7) return;
+      stats.msbSkipped += (s.kind == Kind::Nrpn ? 4 : 2) - len;
+      s.sentMsb[sink] = (uint8_t)((s.value >> 7) & 0x7F);
+      if (s.kind == Kind::Nrpn) nrpnSel[sink] = paramKey(s);
+    }
+
+    void account(uint8_t sink, Priority p, uint32_t lag) {
+      const uint8_t c = (uint8_t)p;
+      stats.lagSumUs[sink][c] += lag;
+      if (lag > stats.lagMaxUs[sink][c]) stats.lagMaxUs[sink][c] = lag;
+      ++stats.sent[sink][c];
+    }
+  };
+}
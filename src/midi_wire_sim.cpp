@@ -0,0 +1,355 @@
+// =============================
+// File: src/midi_wire_sim.cpp
+// =============================
+#include "midi_wire_sim.h"
+#include "midi_din.h"
+#include "midi_out.h"
+#include "tempo_module.h"
+
+namespace {
+  static constexpr uint32_t TICK_MS = 1;      // input scan period the traffic is generated at
+  static constexpr uint8_t  MAX_PER_TICK = 8;
+
+  struct Msg { uint8_t status, d1, d2; };
+
+  // Each scenario is a function of time; `last` keeps per-fader values so a CC
+  // is only produced when the 7-bit value changes, as the fader scan would.
+  struct Scenario {
+    const char* name;
+    uint16_t    durationMs;
+    uint8_t   (*at)(uint32_t tMs, int16_t* last, Msg* out);
+  };
+
+  uint8_t faderSweep(uint32_t tMs, uint16_t sweepMs, int16_t* last, Msg* out) {
+    uint8_t n = 0;
+    for (uint8_t f = 0; f < 4; ++f) {
+      // Triangle 0..127..0, faders a quarter period apart
+      const uint32_t phase = (tMs + f * sweepMs / 2) % (2UL * sweepMs);
+      const uint32_t pos   = phase < sweepMs ? phase : 2UL * sweepMs - phase;
+      const int16_t  v     = (int16_t)(pos * 127UL / sweepMs);
+      if (v != last[f]) { last[f] = v; out[n++] = { 0xB0, (uint8_t)(20 + f), (uint8_t)v }; }
+    }
+    return n;
+  }
+
+  uint8_t stompTaps(uint32_t tMs, int16_t* last, Msg* out) {
+    if (tMs % 125) return 0;
+    const uint8_t k = (uint8_t)((tMs / 125) % 4);
+    last[4 + k] = last[4 + k] ? 0 : 127;
+    out[0] = { 0xB0, (uint8_t)(80 + k), (uint8_t)last[4 + k] };
+    return 1;
+  }
+
+  uint8_t slowSweep(uint32_t t, int16_t* l, Msg* o)  { return faderSweep(t, 500, l, o); }
+  uint8_t fastSweep(uint32_t t, int16_t* l, Msg* o)  { return faderSweep(t, 100, l, o); }
+  uint8_t stomps(uint32_t t, int16_t* l, Msg* o)     { return stompTaps(t, l, o); }
+  uint8_t sweepStomps(uint32_t t, int16_t* l, Msg* o) {
+    const uint8_t n = faderSweep(t, 500, l, o);
+    return n + stompTaps(t, l, o + n);
+  }
+  // Preset changes every 50 ms while the link is saturated by faders
+  uint8_t fastSweepPc(uint32_t t, int16_t* l, Msg* o) {
+    uint8_t n = faderSweep(t, 100, l, o);
+    if (t % 50 == 7) o[n++] = { 0xC0, (uint8_t)((t / 50) & 0x7F), 0 };
+    return n;
+  }
+
+  static const Scenario SCENARIOS[] = {
+    { "4 faders, 500 ms sweeps", 2000, slowSweep },
+    { "4 faders, 100 ms sweeps", 2000, fastSweep },
+    { "stomp taps, 8/s",         2000, stomps },
+    { "sweeps + stomp taps",     2000, sweepStomps },
+    { "100 ms sweeps + PC/50 ms", 2000, fastSweepPc },
+  };
+
+  inline bool isStomp(uint8_t cc) { return cc >= 80 && cc < 84; }   // as stompTaps
+
+  enum class Mode : uint8_t { Fifo, RunningStatus, Coalesced };
+
+  struct Result {
+    uint32_t msgs, bytes, dropped;
+    uint32_t coalesced;       // writes superseded before they were sent
+    uint32_t wireUs;          // last byte done
+    uint16_t maxBacklog;
+    uint32_t latSumUs, latMaxUs;   // CCs: write -> newest value for that CC fully on the wire
+    uint32_t pcMsgs, pcLatSumUs, pcLatMaxUs;   // program changes: request -> fully on the wire
+  };
+
+  // Byte i leaves the wire at done[i]; a FIFO of those times is the queue
+  struct Wire {
+    uint32_t done[midi_din::RING_BYTES];
+    uint16_t head = 0, len = 0;
+    uint32_t freeUs = 0;
+
+    void retire(uint32_t nowUs) {
+      while (len && done[head] <= nowUs) { head = (head + 1) % midi_din::RING_BYTES; --len; }
+    }
+    uint32_t push(uint8_t n, uint32_t nowUs) {   // returns when the last byte is done
+      for (uint8_t b = 0; b < n; ++b) {
+        freeUs = (freeUs > nowUs ? freeUs : nowUs) + midi_din::BYTE_US;
+        done[(head + len) % midi_din::RING_BYTES] = freeUs;
+        ++len;
+      }
+      return freeUs;
+    }
+  };
+
+  void account(Result& r, uint8_t status, uint32_t lat, uint8_t n, uint16_t backlog) {
+    if ((status & 0xF0) == 0xC0) {
+      ++r.pcMsgs;
+      r.pcLatSumUs += lat;
+      if (lat > r.pcLatMaxUs) r.pcLatMaxUs = lat;
+    } else {
+      r.latSumUs += lat;
+      if (lat > r.latMaxUs) r.latMaxUs = lat;
+    }
+    ++r.msgs;
+    r.bytes += n;
+    if (backlog > r.maxBacklog) r.maxBacklog = backlog;
+  }
+
+  Result simulateFifo(const Scenario& sc, bool runningStatus) {
+    Result r = {};
+    int16_t last[8];
+    for (int16_t& v : last) v = -1;
+    midi_din::RunningStatus rs;
+    static Wire w;
+    w = Wire();
+
+    for (uint32_t t = 0; t < sc.durationMs; t += TICK_MS) {
+      const uint32_t nowUs = t * 1000UL;
+      w.retire(nowUs);
+
+      Msg m[MAX_PER_TICK];
+      const uint8_t n = sc.at(t, last, m);
+      for (uint8_t i = 0; i < n; ++i) {
+        uint8_t bytes[3];
+        uint8_t len;
+        if (runningStatus) {
+          midi_din::RunningStatus trial = rs;
+          len = trial.encode(m[i].status, m[i].d1, m[i].d2, t, bytes);
+          if (w.len + len > midi_din::RING_BYTES - 1) { ++r.dropped; continue; }
+          rs = trial;
+        } else {
+          len = midi_din::messageLength(m[i].status);
+          if (w.len + len > midi_din::RING_BYTES - 1) { ++r.dropped; continue; }
+        }
+        account(r, m[i].status, w.push(len, nowUs) - nowUs, len, w.len);
+      }
+    }
+    r.wireUs = w.freeUs;
+    return r;
+  }
+
+  // midi_out's scheduler in front of the same wire, drained every DRAIN_US
+  // as midi_out::update() does: PCs in the Program class, stomp CCs in the
+  // Stomp class, faders held to DIN_BUDGET_BYTES
+  Result simulateCoalesced(const Scenario& sc) {
+    static constexpr uint32_t DRAIN_US = 100;
+    Result r = {};
+    int16_t last[8];
+    for (int16_t& v : last) v = -1;
+    midi_din::RunningStatus rs;
+    static Wire w;
+    static midi_out::Coalescer co;
+    w = Wire();
+    co = midi_out::Coalescer();
+    uint32_t pcAt[midi_out::URGENT_SLOTS];   // request times, in queue order
+    uint8_t  pcHead = 0, pcTail = 0;
+
+    for (uint32_t t = 0; t < sc.durationMs || co.owed(0); t += TICK_MS) {
+      if (t < sc.durationMs) {
+        Msg m[MAX_PER_TICK];
+        const uint8_t n = sc.at(t, last, m);
+        for (uint8_t i = 0; i < n; ++i) {
+          if ((m[i].status & 0xF0) == 0xC0) {
+            if (co.putUrgent(0, 0xC0, m[i].d1, 0, 1, t * 1000UL)) pcAt[pcHead++ % midi_out::URGENT_SLOTS] = t * 1000UL;
+            continue;
+          }
+          const midi_out::Priority p = isStomp(m[i].d1) ? midi_out::Priority::Stomp : midi_out::Priority::Fader;
+          co.put(0, midi_out::Kind::Cc7, m[i].d1, m[i].d2, p, 1, t * 1000UL);
+        }
+      }
+      for (uint32_t us = t * 1000UL; us < (t + TICK_MS) * 1000UL; us += DRAIN_US) {
+        w.retire(us);
+        co.drain(0, us, [&](midi_out::Priority prio, uint8_t, const midi_out::Msg* m, uint8_t n) {
+          if (prio == midi_out::Priority::Fader && w.len + 3 > midi_out::DIN_BUDGET_BYTES) return false;
+          if (w.len + 3u * n > midi_din::RING_BYTES - 1) return false;
+          uint8_t bytes[3];
+          uint8_t len = 0;
+          for (uint8_t i = 0; i < n; ++i) len += rs.encode(m[i].kind, m[i].d1, m[i].d2, us / 1000UL, bytes);
+          uint32_t since = us;
+          if (m[0].kind == 0xC0) since = pcAt[pcTail++ % midi_out::URGENT_SLOTS];
+          else for (uint8_t i = 0; i < co.count; ++i) if (co.slots[i].num == m[0].d1) since = co.slots[i].sinceUs[0];
+          account(r, m[0].kind, w.push(len, us) - since, len, w.len);
+          return true;
+        });
+      }
+    }
+    r.coalesced = co.stats.coalesced;
+    r.dropped = co.stats.dropped;
+    r.wireUs = w.freeUs;
+    return r;
+  }
+
+  void printRow(Print& out, const char* name, Mode mode, const Result& r) {
+    static const char* const LABELS[] = { "fifo", "fifo+rs", "midi_out" };
+    out.print(F("  ")); out.print(name);
+    for (size_t pad = strlen(name); pad < 26; ++pad) out.print(' ');
+    out.print(LABELS[(uint8_t)mode]);
+    for (size_t pad = strlen(LABELS[(uint8_t)mode]); pad < 9; ++pad) out.print(' ');
+    out.print(F("msgs=")); out.print(r.msgs);
+    out.print(F(" bytes=")); out.print(r.bytes);
+    out.print(F(" wire=")); out.print(r.wireUs / 1000.0f, 1); out.print(F("ms"));
+    out.print(F(" backlog max=")); out.print(r.maxBacklog);
+    const uint32_t ccs = r.msgs - r.pcMsgs;
+    out.print(F(" lag avg/max=")); out.print(ccs ? r.latSumUs / 1000.0f / ccs : 0.0f, 2);
+    out.print('/'); out.print(r.latMaxUs / 1000.0f, 2); out.print(F("ms"));
+    if (r.pcMsgs) {
+      out.print(F(" pc=")); out.print(r.pcMsgs);
+      out.print(F(" pc lat avg/max=")); out.print(r.pcLatSumUs / 1000.0f / r.pcMsgs, 2);
+      out.print('/'); out.print(r.pcLatMaxUs / 1000.0f, 2); out.print(F("ms"));
+    }
+    if (mode == Mode::Coalesced) { out.print(F(" coalesced=")); out.print(r.coalesced); }
+    out.print(F(" dropped=")); out.println(r.dropped);
+  }
+
+  // ---- MIDI clock ----
+  // loop() as a run of passes of 0.7-1.3 ms with a 20 ms display redraw in
+  // about one pass in 40. Fader sweeps go through the scheduler at each pass
+  // start. The clock either comes from a timer ISR straight into the UART
+  // FIFO at the exact tick time, or is polled by loop() and queued at the
+  // first pass start after it was due. Jitter is how far each interval
+  // between clock bytes leaving the wire is off the nominal tick.
+  static constexpr uint32_t CLOCK_SIM_MS = 4000;
+  static constexpr uint32_t PASS_MIN_US  = 700;
+  static constexpr uint32_t PASS_SPAN_US = 600;
+  static constexpr uint32_t REDRAW_US    = 20000;
+  static constexpr uint8_t  REDRAW_ONE_IN = 40;
+
+  struct ClockResult {
+    uint32_t ticks;
+    uint32_t devSumUs, devMaxUs;
+    float    devSq;
+  };
+
+  inline uint32_t lcg(uint32_t& s) { s = s * 1664525UL + 1013904223UL; return s >> 8; }
+
+  ClockResult simulateClock(bool fromIsr, uint32_t tickUs) {
+    ClockResult r = {};
+    int16_t last[8];
+    for (int16_t& v : last) v = -1;
+    midi_din::RunningStatus rs;
+    static Wire w;
+    static midi_out::Coalescer co;
+    w = Wire();
+    co = midi_out::Coalescer();
+    uint32_t seed = 12345;          // same loop timing for both variants
+    uint32_t passUs = 0, genMs = 0, nextTick = tickUs, prevDone = 0;
+    bool havePrev = false;
+
+    auto record = [&](uint32_t done) {
+      if (havePrev) {
+        const uint32_t iv  = done - prevDone;
+        const uint32_t dev = iv > tickUs ? iv - tickUs : tickUs - iv;
+        ++r.ticks;
+        r.devSumUs += dev;
+        r.devSq += (float)dev * (float)dev;
+        if (dev > r.devMaxUs) r.devMaxUs = dev;
+      }
+      prevDone = done;
+      havePrev = true;
+    };
+
+    while (nextTick <= CLOCK_SIM_MS * 1000UL) {
+      uint32_t passEnd = passUs + PASS_MIN_US + lcg(seed) % PASS_SPAN_US;
+      if (lcg(seed) % REDRAW_ONE_IN == 0) passEnd += REDRAW_US;
+
+      // Pass start: scan what the faders did since the last pass, then drain
+      w.retire(passUs);
+      for (; genMs <= passUs / 1000UL; ++genMs) {
+        Msg m[MAX_PER_TICK];
+        const uint8_t n = faderSweep(genMs, 100, last, m);
+        for (uint8_t i = 0; i < n; ++i)
+          co.put(0, midi_out::Kind::Cc7, m[i].d1, m[i].d2, midi_out::Priority::Fader, 1, genMs * 1000UL);
+      }
+      if (!fromIsr)
+        for (; nextTick <= passUs; nextTick += tickUs) record(w.push(1, passUs));
+      co.drain(0, passUs, [&](midi_out::Priority, uint8_t, const midi_out::Msg* m, uint8_t n) {
+        if (w.len + 3u * n > midi_out::DIN_BUDGET_BYTES) return false;
+        uint8_t bytes[3];
+        uint8_t len = 0;
+        for (uint8_t i = 0; i < n; ++i) len += rs.encode(m[i].kind, m[i].d1, m[i].d2, passUs / 1000UL, bytes);
+        w.push(len, passUs);
+        return true;
+      });
+
+      // During the pass: the timer fires on time whatever loop() is doing
+      if (fromIsr)
+        for (; nextTick <= passEnd; nextTick += tickUs) { w.retire(nextTick); record(w.push(1, nextTick)); }
+      passUs = passEnd;
+    }
+    return r;
+  }
+
+  void printClockRow(Print& out, const char* name, const ClockResult& r) {
+    out.print(F("  ")); out.print(name);
+    for (size_t pad = strlen(name); pad < 20; ++pad) out.print(' ');
+    out.print(F("intervals=")); out.print(r.ticks);
+    const float n = r.ticks ? (float)r.ticks : 1.0f;
+    const float mean = r.devSumUs / n;
+    out.print(F(" jitter avg/max/sd=")); out.print(mean, 0);
+    out.print('/'); out.print(r.devMaxUs);
+    out.print('/'); out.print(sqrtf(r.devSq / n), 0); out.println(F(" us"));
+  }
+
+  // Human taps at 120 BPM (+-15 ms), a double hit, a missed beat, then a
+  // move to 90 BPM; prints the tempo after each tap ('-' = unchanged)
+  void simulateTaps(Print& out) {
+    tempo_module::TapTempo tt;
+    uint32_t seed = 777, t = 1000000, bpm = 0;
+    out.print(F("  taps:"));
+    for (uint8_t i = 0; i < 20; ++i) {
+      const uint32_t beat = i < 12 ? 500000 : 666667;
+      t += (i == 8 ? 2 * beat : beat) + (lcg(seed) % 31) * 1000UL - 15000UL;   // tap 8: one beat missed
+      for (uint8_t k = 0; k < (i == 4 ? 2 : 1); ++k) {                           // tap 4: double hit 40 ms apart
+        const uint32_t us = tt.tap(t + k * 40000UL);
+        out.print(' ');
+        if (us) { bpm = us; out.print(60000000.0f / us, 1); }
+        else out.print('-');
+      }
+    }
+    out.println();
+    out.print(F("  final ")); out.print(bpm ? 60000000.0f / bpm : 0.0f, 1);
+    out.print(F(" BPM, taps=")); out.print(tt.taps);
+    out.print(F(" outliers=")); out.println(tt.outliers);
+  }
+}
+
+void midi_wire_sim::run(Print& out) {
+  out.print(F("[midi sim] 31250 baud, ")); out.print(midi_din::BYTE_US); out.print(F(" us/byte, queue "));
+  out.print(midi_din::RING_BYTES); out.println(F(" bytes, scan 1 ms"));
+  for (const Scenario& sc : SCENARIOS) {
+    const Result off  = simulateFifo(sc, false);
+    const Result on   = simulateFifo(sc, true);
+    const Result coal = simulateCoalesced(sc);
+    printRow(out, sc.name, Mode::Fifo, off);
+    printRow(out, sc.name, Mode::RunningStatus, on);
+    printRow(out, sc.name, Mode::Coalesced, coal);
+    if (off.bytes) {
+      out.print(F("    running status saves ")); out.print(100.0f * (off.bytes - on.bytes) / off.bytes, 1);
+      out.println(F("% of bytes"));
+    }
+  }
+}
+
+void midi_wire_sim::clock(Print& out) {
+  static constexpr uint32_t BEAT_US = 500000;   // 120 BPM
+  const uint32_t tickUs = (BEAT_US + tempo_module::PPQN / 2) / tempo_module::PPQN;
+  out.print(F("[midi clock] 120 BPM, ")); out.print(tempo_module::PPQN); out.print(F(" ppqn, tick "));
+  out.print(tickUs); out.print(F(" us; loop 0.7-1.3 ms passes, 20 ms redraw 1 in "));
+  out.print(REDRAW_ONE_IN); out.println(F("; 4 faders, 100 ms sweeps"));
+  printClockRow(out, "timer ISR -> FIFO", simulateClock(true, tickUs));
+  printClockRow(out, "polled in loop()", simulateClock(false, tickUs));
+  simulateTaps(out);
+}
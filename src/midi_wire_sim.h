@@ -0,0 +1,20 @@
+// =============================
+// File: src/midi_wire_sim.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// Wire-time model of the DIN output: replays synthetic fader/stomp traffic
+// through midi_din's running-status encoder into a 31.25 kbaud UART with a
+// RING_BYTES queue, and reports bytes, wire time, backlog and lag (write to
+// the newest value for that CC fully on the wire) for a plain FIFO, a FIFO
+// with running status, and midi_out's scheduler (coalescing + priority
+// classes). Program changes are reported separately. clock() compares MIDI
+// clock from a timer ISR with clock polled by loop() under the same fader
+// traffic and loop load, and replays a tap sequence through TapTempo.
+// Needs only Print, the encoder and the slot table, so it runs on the device ("midi sim")
+// or from a host build.
+namespace midi_wire_sim {
+  void run(Print& out);
+  void clock(Print& out);
+}
@@ -3,10 +3,20 @@
 // =============================
 #include "mirror_module.h"
 #include <Arduino.h>
+#include <esp_timer.h>
 #include "mux_module.h"
+#include "fader_module.h"
+#include "settings_module.h"
+#include "mode_manager.h"
+#include "midi_out.h"
 
 // Detect short/long presses on the logical "Mirror" input from the 4051.
 // NOTE: This now uses the logical map (MuxInput::Mirror) rather than a hardcoded channel.
+//
+// A short press in play mode snapshots every fader and arms a one-shot
+// esp_timer for the mirror delay; update() sends the burst once it fires.
+// A long press is left to mode_manager, which switches setup <-> play.
+// midi_out paces it like any fader traffic, so the UI never waits on the wire.
 
 namespace {
   static const unsigned long LONG_PRESS_MS = 1000; // 1s long press threshold
@@ -14,6 +24,66 @@ namespace {
   static unsigned long press_time = 0;             // millis at press edge
   static bool long_press_detected = false;         // latched when threshold crossed
   static bool long_press_consumed = false;         // cleared by pressedLong()
+  static bool begun = false;
+
+  // Burst state. The timer callback runs on the esp_timer task and only sets
+  // s_due; the burst itself goes out from update().
+  struct Snap { uint8_t res; int16_t level; };
+  static Snap               s_snap[fader_module::COUNT];
+  static esp_timer_handle_t s_timer = nullptr;
+  static volatile bool      s_due = false;
+  static bool               s_armed = false;
+  static mirror_module::Stats s_stats = {};
+
+  void onTimer(void*) { s_due = true; }
+
+  // Same clamp as setup_mirror_delay
+  uint32_t delayMs() {
+    float s = settings_module::getMirrorDelay();
+    if (!(s > 0.0f)) s = 1.0f;
+    if (s < 0.1f) s = 0.1f; else if (s > 3.0f) s = 3.0f;
+    return (uint32_t)(s * 1000.0f + 0.5f);
+  }
+
+  // A second press before the timer fires takes a new snapshot and restarts it
+  void arm() {
+    if (!s_timer) return;
+    for (uint8_t i = 0; i < fader_module::COUNT; ++i)
+      s_snap[i] = { fader_module::resolution(i), fader_module::level(i) };
+    esp_timer_stop(s_timer);
+    s_due = false;
+    s_armed = esp_timer_start_once(s_timer, (uint64_t)delayMs() * 1000ULL) == ESP_OK;
+  }
+
+  // Controller a fader is sent as, so two faders on one CC go out once
+  uint32_t target(uint8_t i, uint8_t res) {
+    const uint8_t cc = settings_module::getFaderCC(i);
+    if (res == settings_module::FADER_RES_NRPN)
+      return ((uint32_t)res << 16) | ((uint32_t)settings_module::getFaderNrpnMsb(i) << 7) | cc;
+    return ((uint32_t)res << 16) | cc;
+  }
+
+  // A fader that moved (or changed resolution) since the press has already
+  // sent a newer value; resending the snapshot would pull the receiver back
+  void fire() {
+    s_armed = false;
+    midi_out::resync();   // the receiver may have lost its NRPN/MSB state
+    uint32_t done[fader_module::COUNT];
+    uint8_t sent = 0, stale = 0, dup = 0;
+    for (uint8_t i = 0; i < fader_module::COUNT; ++i) {
+      const Snap& sn = s_snap[i];
+      if (sn.level < 0 || fader_module::resolution(i) != sn.res || fader_module::level(i) != sn.level) { ++stale; continue; }
+      const uint32_t t = target(i, sn.res);
+      bool seen = false;
+      for (uint8_t k = 0; k < sent; ++k) if (done[k] == t) { seen = true; break; }
+      if (seen) { ++dup; continue; }
+      if (fader_module::resend(i)) done[sent++] = t;
+    }
+    ++s_stats.bursts;
+    s_stats.sent  += sent;
+    s_stats.stale += stale;
+    s_stats.dup   += dup;
+  }
 
   inline bool mirror_now() {
     // Read the logical Mirror input (active LOW inside mux_module)
@@ -22,10 +92,14 @@ namespace {
 }
 
 void mirror_module::begin() {
+  if (begun) return;
+  begun = true;
   prev_state = mirror_now();
   long_press_detected = false;
   long_press_consumed = false;
   press_time = 0;
+  const esp_timer_create_args_t args = { onTimer, nullptr, ESP_TIMER_TASK, "mirror", false };
+  if (esp_timer_create(&args, &s_timer) != ESP_OK) s_timer = nullptr;
 }
 
 void mirror_module::update() {
@@ -49,15 +123,17 @@ void mirror_module::update() {
 
   // Falling edge (released)
   if (!state && prev_state) {
-    if (!long_press_detected) {
-      // Debug-only: short press intent on Mirror button
-      Serial.println(F("Mirror short press"));
-    }
+    if (!long_press_detected && !mode_manager::inSetupMode()) arm();
     // If it was a long press, app can query pressedLong() once; we keep the flag
     // until consumed by pressedLong().
   }
 
   prev_state = state;
+
+  if (s_due) {
+    s_due = false;
+    if (s_armed) fire();
+  }
 }
 
 bool mirror_module::pressedLong() {
@@ -67,3 +143,17 @@ bool mirror_module::pressedLong() {
   }
   return false;
 }
+
+bool mirror_module::burstPending() {
+  return s_armed;
+}
+
+const mirror_module::Stats& mirror_module::stats() { return s_stats; }
+
+void mirror_module::printStats(Print& out) {
+  out.print(F("[mirror] bursts=")); out.print(s_stats.bursts);
+  out.print(F(" sent=")); out.print(s_stats.sent);
+  out.print(F(" stale=")); out.print(s_stats.stale);
+  out.print(F(" dup=")); out.print(s_stats.dup);
+  out.print(F(" pending=")); out.println(s_armed ? 1 : 0);
+}
@@ -2,6 +2,7 @@
 // File: src/mirror_module.h
 // =============================
 #pragma once
+#include <Arduino.h>
 
 namespace mirror_module {
   void begin();  // Setup mirror button parameters
@@ -9,4 +10,16 @@ namespace mirror_module {
 
   // Returns true if a long press (>= LONG_PRESS_MS) was detected
   bool pressedLong();
+
+  // True from a short press until its "send all faders" burst goes out
+  bool burstPending();
+
+  struct Stats {
+    uint32_t bursts;
+    uint32_t sent;     // faders resent
+    uint32_t stale;    // moved or changed resolution during the delay
+    uint32_t dup;      // same controller as an earlier fader in the burst
+  };
+  const Stats& stats();
+  void printStats(Print& out = Serial);
 };
\ No newline at end of file
@@ -1,16 +1,15 @@
 // File: mode_manager.cpp
 #include "mode_manager.h"
-#include "mirror_module.h"
 #include "settings_module.h"
 #include "setup_module.h"
 #include "play_module.h"
+#include "mirror_module.h"
+#include "boot_profile.h"
 
 bool setupMode = false;
 
+// module_manager begins settings, display, encoder and mirror first (MOD_MODE deps)
 void mode_manager::begin() {
-  mirror_module::begin();
-  settings_module::begin();
-
   setupMode = true;  // force SETUP screen on boot for now
 
   if (setupMode) {
@@ -18,9 +17,36 @@ void mode_manager::begin() {
   } else {
     play_module::begin();
   }
+  boot_profile::mark(boot_profile::Milestone::FirstFrame);
+}
+
+bool mode_manager::inSetupMode() { return setupMode; }
+
+void mode_manager::setSetupMode(bool on) {
+  if (on == setupMode) return;
+  setupMode = on;
+  if (setupMode) {
+    setup_module::begin();
+  } else {
+    setup_module::end();
+    settings_module::flushNow();
+    play_module::begin();
+  }
+}
+
+// Overlays (MIDI monitor, screen walk) draw over whatever mode is active
+void mode_manager::redraw() {
+  if (setupMode) {
+    setup_module::begin();
+  } else {
+    setup_module::end();
+    play_module::begin();
+  }
 }
 
+// A long press on the mirror button switches between setup and play
 void mode_manager::update() {
+  if (mirror_module::pressedLong()) setSetupMode(!setupMode);
   if (setupMode) {
     setup_module::update();
   } else {
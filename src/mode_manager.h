@@ -5,4 +5,6 @@ namespace mode_manager {
   void begin();
   void update();
   bool inSetupMode();
+  void setSetupMode(bool on);  // leaving setup commits pending settings
+  void redraw();               // repaint the current mode's screen after an overlay
 };
\ No newline at end of file
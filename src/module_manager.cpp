@@ -1,26 +1,110 @@
-// File: module_manager.cpp (updated)
-// IMPORTANT: Append new modules only.
+// File: module_manager.cpp (v2: dependency-ordered registry)
+// Add a module by giving it an id and one MODULES row; order no longer matters.
 #include "module_manager.h"
-#include "display_module.h"
 
 namespace module_manager {
-  const module_fn BEGIN_FNS[] = {
-    display_module::begin,
-    settings_module::begin,
-    mux_module::begin,
-    encoder_module::begin,
-    mirror_module::begin,
-    mode_manager::begin
-  };
-  const size_t BEGIN_COUNT = sizeof(BEGIN_FNS) / sizeof(BEGIN_FNS[0]);
-
-  const module_fn UPDATE_FNS[] = {
-    mux_module::update,
-    encoder_module::update,
-    mirror_module::update,
-    setup_module::update,
-    mode_manager::update,
-    display_module::update
-  };
-  const size_t UPDATE_COUNT = sizeof(UPDATE_FNS) / sizeof(UPDATE_FNS[0]);
-}
\ No newline at end of file
+  namespace {
+    enum ModuleId : uint8_t {
+      MOD_SETTINGS, MOD_BRIGHTNESS, MOD_DISPLAY, MOD_MUX, MOD_ENCODER, MOD_MIRROR,
+      MOD_MODE, MOD_CONSOLE, MOD_BOOT, MOD_MIDI_DIN, MOD_MIDI_BLE, MOD_MIDI_OUT, MOD_FADER, MOD_STOMP,
+      MOD_TEMPO,
+      MOD_COUNT
+    };
+    static_assert(MOD_COUNT <= 32, "dependency masks are 32 bits");
+
+    constexpr uint32_t dep(ModuleId m) { return 1UL << m; }
+
+    struct Module {
+      ModuleId    id;
+      const char* name;
+      module_fn   begin;     // may be nullptr
+      module_fn   update;    // may be nullptr
+      uint32_t    deps;      // modules whose begin() must run first
+      uint16_t    periodMs;  // 0 = every pass
+    };
+
+    // setup_module/play_module are driven by mode_manager, not listed here.
+    constexpr Module MODULES[MOD_COUNT] = {
+      { MOD_SETTINGS,   "settings",   settings_module::begin,   settings_module::update,   0,                                 100 },
+      { MOD_BRIGHTNESS, "brightness", brightness_module::begin, brightness_module::update, dep(MOD_SETTINGS),                 50 },
+      { MOD_DISPLAY,    "display",    display_module::begin,    display_module::update,    dep(MOD_SETTINGS) | dep(MOD_BRIGHTNESS), 0 },
+      { MOD_MUX,        "mux",        mux_module::begin,        mux_module::update,        0,                                 0 },
+      { MOD_ENCODER,    "encoder",    encoder_module::begin,    encoder_module::update,    dep(MOD_MUX),                      0 },
+      { MOD_MIRROR,     "mirror",     mirror_module::begin,     mirror_module::update,     dep(MOD_MUX) | dep(MOD_FADER),     0 },
+      { MOD_MODE,       "mode",       mode_manager::begin,      mode_manager::update,
+        dep(MOD_SETTINGS) | dep(MOD_DISPLAY) | dep(MOD_BRIGHTNESS) | dep(MOD_ENCODER) | dep(MOD_MIRROR), 0 },
+      { MOD_CONSOLE,    "console",    serial_console::begin,    serial_console::update,    dep(MOD_MODE),                     0 },
+      { MOD_BOOT,       "boot",       nullptr,                  boot_profile::update,      dep(MOD_MODE),                     100 },
+      { MOD_MIDI_DIN,   "midi_din",   midi_din::begin,          midi_din::update,          dep(MOD_SETTINGS),                 0 },
+      { MOD_MIDI_BLE,   "midi_ble",   midi_ble::begin,          midi_ble::update,          dep(MOD_SETTINGS),                 0 },
+      { MOD_MIDI_OUT,   "midi_out",   nullptr,                  midi_out::update,          dep(MOD_MIDI_DIN) | dep(MOD_MIDI_BLE), 0 },
+      { MOD_FADER,      "fader",      fader_module::begin,      fader_module::update,      dep(MOD_SETTINGS) | dep(MOD_MIDI_OUT), 2 },
+      { MOD_STOMP,      "stomp",      stomp_module::begin,      stomp_module::update,      dep(MOD_MUX) | dep(MOD_SETTINGS) | dep(MOD_MIDI_OUT) | dep(MOD_TEMPO), 1 },
+      { MOD_TEMPO,      "tempo",      tempo_module::begin,      tempo_module::update,      dep(MOD_MIDI_DIN) | dep(MOD_MIDI_BLE), 0 },
+    };
+
+    constexpr bool rowsMatchIds() {
+      for (uint8_t i = 0; i < MOD_COUNT; ++i) {
+        if (MODULES[i].id != i) return false;
+        if (MODULES[i].deps >> MOD_COUNT) return false;   // unknown module
+      }
+      return true;
+    }
+    static_assert(rowsMatchIds(), "MODULES rows must be in ModuleId order and depend on known ids");
+
+    // Kahn's algorithm; ties keep table order
+    struct InitOrder { uint8_t at[MOD_COUNT]; bool acyclic; };
+    constexpr InitOrder topoSort() {
+      InitOrder o = {};
+      uint32_t done = 0;
+      uint8_t  n = 0;
+      while (n < MOD_COUNT) {
+        bool progressed = false;
+        for (uint8_t i = 0; i < MOD_COUNT; ++i) {
+          if (done & (1UL << i)) continue;
+          if (MODULES[i].deps & ~done) continue;
+          o.at[n++] = i;
+          done |= 1UL << i;
+          progressed = true;
+        }
+        if (!progressed) return o;   // what is left depends on itself
+      }
+      o.acyclic = true;
+      return o;
+    }
+    constexpr InitOrder ORDER = topoSort();
+    static_assert(ORDER.acyclic, "module dependency cycle in MODULES");
+
+    static unsigned long s_lastRun[MOD_COUNT];
+  }
+
+  void begin_all() {
+    Serial.print("Running begin_all, count = ");
+    Serial.println((int)MOD_COUNT);
+    const unsigned long now = millis();
+    for (uint8_t k = 0; k < MOD_COUNT; ++k) {
+      const Module& m = MODULES[ORDER.at[k]];
+      if (m.begin) m.begin();
+      s_lastRun[m.id] = now;
+    }
+  }
+
+  void update_all() {
+    const unsigned long now = millis();
+    for (uint8_t k = 0; k < MOD_COUNT; ++k) {
+      const Module& m = MODULES[ORDER.at[k]];
+      if (!m.update) continue;
+      if (m.periodMs && now - s_lastRun[m.id] < m.periodMs) continue;
+      s_lastRun[m.id] = now;
+      m.update();
+    }
+  }
+
+  void printOrder(Print& out) {
+    for (uint8_t k = 0; k < MOD_COUNT; ++k) {
+      const Module& m = MODULES[ORDER.at[k]];
+      out.print(F("  ")); out.print(k); out.print(' '); out.print(m.name);
+      out.print(F(" every ")); out.print(m.periodMs); out.println(F(" ms"));
+    }
+  }
+}
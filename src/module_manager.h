@@ -1,4 +1,4 @@
-// File: module_manager.h (updated)
+// File: module_manager.h (v2: dependency-ordered registry)
 #pragma once
 #include <stddef.h>
 #include "mux_module.h"
@@ -9,21 +9,29 @@
 #include "mode_manager.h"
 #include "setup_module.h"
 #include "play_module.h"
+#include "serial_console.h"
+#include "brightness_module.h"
+#include "boot_profile.h"
+#include "midi_din.h"
+#include "midi_ble.h"
+#include "midi_out.h"
+#include "fader_module.h"
+#include "stomp_module.h"
+#include "tempo_module.h"
 
 using module_fn = void(*)();
 
+// Modules are declared once in module_manager.cpp with the modules they
+// depend on and an update period. Init order is a topological sort computed
+// at compile time (a cycle fails the build); update() runs in the same order,
+// each module only when its period has elapsed.
+//
+// begin_all() calls each listed begin() once. setup() also calls
+// settings_module::begin() and (via display_module::earlyInit())
+// brightness_module::begin() before it, so those two must keep their
+// own guards against a second call.
 namespace module_manager {
-  extern const module_fn BEGIN_FNS[];
-  extern const size_t    BEGIN_COUNT;
-  extern const module_fn UPDATE_FNS[];
-  extern const size_t    UPDATE_COUNT;
-
-  inline void begin_all() {
-    Serial.print("Running begin_all, count = ");
-    Serial.println(BEGIN_COUNT);
-    for (size_t i = 0; i < BEGIN_COUNT; ++i) BEGIN_FNS[i]();
-  }
-  inline void update_all() {
-    for (size_t i = 0; i < UPDATE_COUNT; ++i) UPDATE_FNS[i]();
-  }
-}
\ No newline at end of file
+  void begin_all();    // each begin() once, dependencies first
+  void update_all();   // one pass over the modules that are due
+  void printOrder(Print& out = Serial);
+}
@@ -4,12 +4,14 @@
 #include "mux_module.h"
 #include <Arduino.h>
 #include "pinmap_module.h"
+#include "brightness_module.h"
 
 namespace {
   // Debounce & state (lightweight, edge-only prints)
   static bool prev_states_physical[8] = { false,false,false,false,false,false,false,false };
   static unsigned long last_toggle_down_ts = 0;
   static const unsigned long DEBOUNCE_MS = 200;
+  static bool begun = false;
 
   inline void select_channel(uint8_t ch) {
     // Write select lines using configurable bit positions — fixes A/B/C swaps in software
@@ -51,6 +53,8 @@ namespace {
 namespace mux_module {
 
 void begin() {
+  if (begun) return;
+  begun = true;
   pinMode(pinmap::MUX_CONTROL_A, OUTPUT);
   pinMode(pinmap::MUX_CONTROL_B, OUTPUT);
   pinMode(pinmap::MUX_CONTROL_C, OUTPUT);
@@ -88,6 +92,7 @@ void update() {
     if (state != prev_states_physical[ch]) {
       prev_states_physical[ch] = state;
 
+      brightness_module::noteActivity(); // press or release wakes the display
       if (state) { // only on press
         if (ch == pinmap::MUX_CH_TOGGLE_DOWN) {
           if (now - last_toggle_down_ts < DEBOUNCE_MS) continue;
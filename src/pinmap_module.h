@@ -54,7 +54,7 @@ namespace pinmap {
   constexpr uint8_t ENC_PIN_B = 38;
 
   // --- DIN MIDI TX ---
-  constexpr uint8_t MIDI_TX = 39;   // use Serial1.begin(..., /*rx*/-1, pinmap::MIDI_TX)
+  constexpr uint8_t MIDI_TX = 39;   // UART1 TX, set up by midi_din
 
   // --- Faders (ADC capable) ---
   constexpr uint8_t FADER1_PIN = 18;
@@ -4,11 +4,72 @@
 #include "encoder_module.h"
 #include "mirror_module.h"
 #include "settings_module.h"
+#include "fader_module.h"
+#include "midi_ble.h"
+#include "setup_battery.h"
+#include "layout_constants.h"
+#include "image_module.h"
+#include "images/icons.h"
+#include <Adafruit_ST77XX.h>
+
+using display_module::tft;
+
+namespace {
+  static constexpr int8_t UNDRAWN = 2;
+  static int8_t s_pickupShown[fader_module::COUNT];
+
+  // Status row, right to left: power (battery / charging), DIN, BLE while a
+  // central is connected. Each slot is redrawn only when its state changes.
+  static constexpr uint32_t STATUS_POLL_MS = 1000;
+  static constexpr int16_t  POWER_SLOT_W   = 24;   // widest of battery / charging
+  static constexpr int16_t  ICON_H         = 20;
+  static constexpr int16_t  POWER_X = SCREEN_W - PLAY_STATUS_GAP - POWER_SLOT_W;
+  static constexpr int16_t  DIN_X   = POWER_X - PLAY_STATUS_GAP - 20;
+  static constexpr int16_t  BLE_X   = DIN_X - PLAY_STATUS_GAP - 20;
+  static int8_t   s_bleShown, s_chargingShown;
+  static uint32_t s_statusMs;
+
+  // Centred vertically in the icon row
+  void drawIcon(const image_module::Image& img, int16_t x) {
+    image_module::blit(img, x, (int16_t)(PLAY_STATUS_Y + (ICON_H - (int16_t)img.h) / 2));
+  }
+
+  void drawStatus(bool force) {
+    const int8_t ble = midi_ble::connected() ? 1 : 0;
+    if (force || ble != s_bleShown) {
+      if (ble) drawIcon(images::ICON_BLE, BLE_X);
+      else     tft.fillRect(BLE_X, PLAY_STATUS_Y, 20, ICON_H, ST77XX_BLACK);
+      s_bleShown = ble;
+    }
+    const int8_t charging = setup_battery::isCharging() ? 1 : 0;
+    if (force || charging != s_chargingShown) {
+      tft.fillRect(POWER_X, PLAY_STATUS_Y, POWER_SLOT_W, ICON_H, ST77XX_BLACK);
+      if (charging) drawIcon(images::ICON_CHARGING, POWER_X + (POWER_SLOT_W - (int16_t)images::ICON_CHARGING.w) / 2);
+      else          drawIcon(images::ICON_BATTERY, POWER_X);
+      s_chargingShown = charging;
+    }
+    if (force) drawIcon(images::ICON_DIN, DIN_X);   // DIN is always there
+  }
+
+  // Red arrow under fader i pointing the way it has to move to take over
+  // again after a preset / scene change (fader_module::pickup); blank when live
+  void drawPickup(uint8_t i, int8_t dir) {
+    const int16_t cx   = (int16_t)(SCREEN_W * (2 * i + 1) / (2 * fader_module::COUNT));
+    const int16_t half = PLAY_PICKUP_W / 2;
+    const int16_t top = PLAY_PICKUP_Y, bottom = PLAY_PICKUP_Y + PLAY_PICKUP_H - 1;
+    tft.fillRect(cx - half, top, PLAY_PICKUP_W + 1, PLAY_PICKUP_H, ST77XX_BLACK);
+    if (dir > 0)      tft.fillTriangle(cx, top, cx - half, bottom, cx + half, bottom, ST77XX_RED);
+    else if (dir < 0) tft.fillTriangle(cx, bottom, cx - half, top, cx + half, top, ST77XX_RED);
+  }
+}
 
 namespace play_module {
   void begin() {
-    // TODO: clear screen, e.g., display_module::tft.fillScreen(ST77XX_BLACK);
+    tft.fillScreen(ST77XX_BLACK);
     // TODO: implement drawPlayScreen using display_module::tft
+    for (int8_t& d : s_pickupShown) d = UNDRAWN;
+    drawStatus(true);
+    s_statusMs = millis();
   }
 
   void update() {
@@ -16,6 +77,16 @@ namespace play_module {
     // encoder_module currently provides only begin() and update().
     // Track encoder_value changes to detect delta and send MIDI PC messages.
 
+    const uint32_t now = millis();
+    if (now - s_statusMs >= STATUS_POLL_MS) { s_statusMs = now; drawStatus(false); }
+
+    for (uint8_t i = 0; i < fader_module::COUNT; ++i) {
+      const int8_t dir = fader_module::pickup(i);
+      if (dir == s_pickupShown[i]) continue;
+      drawPickup(i, dir);
+      s_pickupShown[i] = dir;
+    }
+
     // TODO: handle short-press, mirror_module::pressed() not implemented
     // if (mirror_module::pressed()) {
     //   // handle stomp presses
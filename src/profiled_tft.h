@@ -0,0 +1,66 @@
+// =============================
+// File: src/profiled_tft.h
+// =============================
+#pragma once
+#include <Adafruit_ST7789.h>
+#include "render_profiler.h"
+
+// Drop-in Adafruit_ST7789 that reports every primitive, address window and
+// command to render_profiler. Every library primitive ends in setAddrWindow()
+// (virtual), so pixels and heatmap are exact; the public wrappers only
+// attribute the call to a primitive. Idle cost is one branch per call.
+class ProfiledST7789 : public Adafruit_ST7789 {
+public:
+  ProfiledST7789(int8_t cs, int8_t dc, int8_t rst) : Adafruit_ST7789(cs, dc, rst) {}
+
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override {
+    render_profiler::noteWindow((int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h);
+    Adafruit_ST7789::setAddrWindow(x, y, w, h);
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t c) override {
+    Scope s(render_profiler::PRIM_PIXEL); Adafruit_ST7789::drawPixel(x, y, c);
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) override {
+    Scope s(render_profiler::PRIM_HLINE); Adafruit_ST7789::drawFastHLine(x, y, w, c);
+  }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) override {
+    Scope s(render_profiler::PRIM_VLINE); Adafruit_ST7789::drawFastVLine(x, y, h, c);
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) override {
+    Scope s(render_profiler::PRIM_FILL_RECT); Adafruit_ST7789::fillRect(x, y, w, h, c);
+  }
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) override {
+    Scope s(render_profiler::PRIM_RECT); Adafruit_ST7789::drawRect(x, y, w, h, c);
+  }
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t c) override {
+    Scope s(render_profiler::PRIM_LINE); Adafruit_ST7789::drawLine(x0, y0, x1, y1, c);
+  }
+  void fillScreen(uint16_t c) override {
+    Scope s(render_profiler::PRIM_FILL_SCREEN); Adafruit_ST7789::fillScreen(c);
+  }
+  size_t write(uint8_t ch) override {
+    Scope s(render_profiler::PRIM_CHAR); return Adafruit_ST7789::write(ch);
+  }
+
+  // Non-virtual in the library: shadowed, so only calls made through tft count
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t c) {
+    Scope s(render_profiler::PRIM_TRIANGLE); Adafruit_ST7789::fillTriangle(x0, y0, x1, y1, x2, y2, c);
+  }
+  void writePixels(uint16_t* colors, uint32_t len, bool block = true, bool bigEndian = false) {
+    Scope s(render_profiler::PRIM_PIXELS); Adafruit_ST7789::writePixels(colors, len, block, bigEndian);
+  }
+  void sendCommand(uint8_t cmd, const uint8_t* data = NULL, uint8_t n = 0) {
+    Scope s(render_profiler::PRIM_COMMAND); render_profiler::noteCommand(n);
+    Adafruit_ST7789::sendCommand(cmd, data, n);
+  }
+  void sendCommand(uint8_t cmd, uint8_t* data, uint8_t n) {
+    sendCommand(cmd, (const uint8_t*)data, n);
+  }
+
+private:
+  struct Scope {
+    explicit Scope(render_profiler::Prim p) { render_profiler::enter(p); }
+    ~Scope() { render_profiler::leave(); }
+  };
+};
@@ -0,0 +1,180 @@
+// =============================
+// File: src/program_change.cpp
+// =============================
+#include "program_change.h"
+#include <stdio.h>
+#include "settings_module.h"
+#include "midi_ble.h"
+
+using program_change::Mode;
+using program_change::Label;
+using program_change::NONE;
+
+namespace {
+  // preset_mode_list order (settings_module PROFILES); the index is the
+  // stored preset mode. PCs are 0-127 within a bank of 128.
+  static constexpr Mode MODES[settings_module::PRESET_MODE_COUNT] = {
+    //  presets base label              bank msb/lsb  scene CC/count
+    {   128,    0,   Label::Number,     NONE, NONE,   NONE, 0 },   // 0-127
+    {   128,    1,   Label::Number,     NONE, NONE,   NONE, 0 },   // 1-128
+    {   128,    1,   Label::Number,     NONE, NONE,   69,   8 },   // Helix: snapshots on CC 69
+    {   128,    1,   Label::GroupSlot,  NONE, NONE,   NONE, 0 },   // Kemper: (perf - 1) * 5 + (slot - 1)
+    {   0,      0,   Label::Number,     0,    NONE,   34,   8 },   // Axe-FX: CC 0 = preset / 128, scenes on CC 34
+    {   512,    1,   Label::BankLetter, 0,    NONE,   NONE, 0 },   // Bias-FX: banks A-D on CC 0
+    // Not specified yet; plain 0-127 until they are
+    {   128,    0,   Label::Number,     NONE, NONE,   NONE, 0 },   // AmpliTube
+    {   128,    0,   Label::Number,     NONE, NONE,   NONE, 0 },   // JamUp
+    {   128,    0,   Label::Number,     NONE, NONE,   NONE, 0 },   // ToneStack
+    {   128,    0,   Label::Number,     NONE, NONE,   NONE, 0 },   // Loopy
+  };
+
+  static constexpr uint16_t AXE_PRESETS[] = { 384, 512 };   // settings_module::AxeModel
+
+  static constexpr bool modesAreValid() {
+    for (const Mode& m : MODES) {
+      const bool banked = m.bankMsbCC != NONE || m.bankLsbCC != NONE;
+      const uint16_t most = m.presets ? m.presets : AXE_PRESETS[1];
+      if (most > (banked ? 16384u : 128u)) return false;          // beyond 128 needs bank select
+      if (m.bankMsbCC != NONE && m.bankMsbCC != 0) return false;  // bank select is CC 0 / CC 32
+      if (m.bankLsbCC != NONE && m.bankLsbCC != 32) return false;
+      if ((m.sceneCC == NONE) != (m.scenes == 0) || m.scenes > 128) return false;
+      if (m.label == Label::BankLetter && most > 26 * 128) return false;
+    }
+    return true;
+  }
+  static_assert(modesAreValid(), "MODES: preset range, bank select and scene CC must agree");
+
+  static constexpr uint8_t KEMPER_SLOTS = 5;
+
+  static uint16_t s_preset   = 0;
+  static uint32_t s_location = program_change::NO_LOCATION;   // scene 0 = as the preset loaded
+  static uint16_t s_changes  = 0;
+  static int32_t  s_bank     = -1;     // bank the receivers were last sent; -1 = unknown
+  static uint8_t  s_mode     = 0xFF;   // settings the bank was sent under
+  static uint8_t  s_axe      = 0xFF;
+  static uint16_t s_sessions = 0;
+
+  inline uint8_t modeIndex() {
+    const uint8_t m = settings_module::getPresetMode();
+    return m < settings_module::PRESET_MODE_COUNT ? m : 0;
+  }
+
+  // A receiver that may not hold s_bank: another mode, another Axe-FX
+  // range, or a BLE central that connected since
+  void sync() {
+    const uint8_t m = modeIndex(), axe = settings_module::getAxeModel();
+    const uint16_t ses = midi_ble::sessions();
+    if (m != s_mode || axe != s_axe || ses != s_sessions) s_bank = -1;
+    s_mode = m; s_axe = axe; s_sessions = ses;
+  }
+
+  bool sendAll(const midi_out::Msg* msg, uint8_t n) {
+    for (uint8_t i = 0; i < n; ++i) {
+      const bool ok = msg[i].kind == 0xC0
+        ? midi_out::programChange(msg[i].d1)
+        : midi_out::controlChange(msg[i].d1, msg[i].d2, midi_out::Priority::Program);
+      if (!ok) return false;
+    }
+    return true;
+  }
+}
+
+const Mode& program_change::mode(uint8_t presetMode) {
+  return MODES[presetMode < settings_module::PRESET_MODE_COUNT ? presetMode : 0];
+}
+
+uint16_t program_change::presets(uint8_t presetMode) {
+  const Mode& m = mode(presetMode);
+  if (m.presets) return m.presets;
+  const uint8_t axe = settings_module::getAxeModel();
+  return AXE_PRESETS[axe <= settings_module::AXE_FX_III ? axe : (uint8_t)settings_module::AXE_FX_III];
+}
+
+uint8_t program_change::plan(const Mode& m, uint16_t presets, uint16_t preset, int32_t lastBank, midi_out::Msg* out) {
+  if (preset >= presets) return 0;
+  uint8_t n = 0;
+  const int32_t bank = preset >> 7;
+  if ((m.bankMsbCC != NONE || m.bankLsbCC != NONE) && bank != lastBank) {
+    // MSB alone carries the bank; with an LSB the pair is one 14-bit number
+    if (m.bankMsbCC != NONE)
+      out[n++] = { 0xB0, m.bankMsbCC, (uint8_t)((m.bankLsbCC != NONE ? bank >> 7 : bank) & 0x7F) };
+    if (m.bankLsbCC != NONE)
+      out[n++] = { 0xB0, m.bankLsbCC, (uint8_t)(bank & 0x7F) };
+  }
+  out[n++] = { 0xC0, (uint8_t)(preset & 0x7F), 0 };
+  return n;
+}
+
+bool program_change::select(uint16_t preset) {
+  sync();
+  const Mode& m = MODES[s_mode];
+  midi_out::Msg msg[MAX_STEPS];
+  const uint8_t n = plan(m, presets(s_mode), preset, s_bank, msg);
+  if (!n) return false;
+  if (!sendAll(msg, n)) { s_bank = -1; return false; }   // queue full: bank state unknown
+  if (m.bankMsbCC != NONE || m.bankLsbCC != NONE) s_bank = preset >> 7;
+  s_preset = preset;
+  s_location = ((uint32_t)s_mode << 24) | ((uint32_t)preset << 8);
+  ++s_changes;
+  return true;
+}
+
+bool program_change::scene(uint8_t scene) {
+  const Mode& m = MODES[modeIndex()];
+  if (scene < 1 || scene > m.scenes) return false;
+  if (!midi_out::controlChange(m.sceneCC, (uint8_t)(scene - 1), midi_out::Priority::Program)) return false;
+  s_location = (s_location & ~0xFFUL) | scene;
+  ++s_changes;
+  return true;
+}
+
+uint32_t program_change::location() { return s_location; }
+uint16_t program_change::changes()  { return s_changes; }
+
+uint16_t program_change::current() {
+  const uint16_t n = presets(modeIndex());
+  return s_preset < n ? s_preset : (uint16_t)(n - 1);
+}
+
+uint16_t program_change::step(uint16_t from, int16_t delta) {
+  const int32_t n = presets(modeIndex());
+  int32_t v = ((int32_t)from + delta) % n;
+  if (v < 0) v += n;
+  return (uint16_t)v;
+}
+
+void program_change::format(uint16_t preset, char* out, size_t n) {
+  const Mode& m = MODES[modeIndex()];
+  switch (m.label) {
+    case Label::GroupSlot:
+      snprintf(out, n, "%u-%u", preset / KEMPER_SLOTS + 1, preset % KEMPER_SLOTS + 1);
+      break;
+    case Label::BankLetter:
+      snprintf(out, n, "%c-%u", 'A' + preset / 128, preset % 128 + 1);
+      break;
+    default:
+      snprintf(out, n, "%u", preset + m.base);
+      break;
+  }
+}
+
+void program_change::forgetBank() { s_bank = -1; }
+
+void program_change::printState(Print& out) {
+  sync();
+  const Mode& m = MODES[s_mode];
+  char label[12];
+  format(current(), label, sizeof(label));
+  out.print(F("[pc] mode=")); out.print(settings_module::presetModeName(s_mode));
+  out.print(F(" presets=")); out.print(presets(s_mode));
+  out.print(F(" current=")); out.print(current()); out.print(F(" (")); out.print(label); out.print(')');
+  out.print(F(" bank="));
+  if (m.bankMsbCC == NONE && m.bankLsbCC == NONE) out.print(F("n/a"));
+  else if (s_bank < 0) out.print(F("unknown"));
+  else out.print(s_bank);
+  if (m.scenes) {
+    out.print(F(" scene=")); out.print((uint8_t)(s_location & 0xFF));
+    out.print('/'); out.print(m.scenes); out.print(F(" on cc")); out.print(m.sceneCC);
+  }
+  out.println();
+}
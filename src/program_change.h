@@ -0,0 +1,60 @@
+// =============================
+// File: src/program_change.h
+// =============================
+#pragma once
+#include <Arduino.h>
+#include "midi_out.h"
+
+// Preset selection for every preset mode. MODES (program_change.cpp) holds
+// one constexpr descriptor per entry of settings_module's preset_mode_list:
+// range, number shown for the first preset, bank select CCs and scene CC.
+// A preset is a 0-based index into the mode's range; plan() turns it into
+// the shortest message sequence - bank select only when the bank differs
+// from the one last sent, then the PC - and select() sends that through
+// midi_out in the Program class.
+namespace program_change {
+  static constexpr uint8_t NONE = 0xFF;   // CC not used by the mode
+
+  enum class Label : uint8_t {
+    Number,       // base + index: "0".."127", "1".."128", "0".."511"
+    GroupSlot,    // Kemper performance-slot, 5 slots each: "1-1".."26-3"
+    BankLetter,   // Bias-FX bank A-D + preset 1-128: "A-1".."D-128"
+  };
+
+  struct Mode {
+    uint16_t presets;      // range; 0 = from the Axe-FX model setting
+    uint8_t  base;         // number shown for index 0 (Label::Number)
+    Label    label;
+    uint8_t  bankMsbCC;    // bank select: CC 0 and/or CC 32, NONE = not sent
+    uint8_t  bankLsbCC;
+    uint8_t  sceneCC;      // snapshot / scene CC, NONE = no scenes
+    uint8_t  scenes;       // scene n is sent as value n - 1
+  };
+
+  constexpr uint8_t MAX_STEPS = 3;   // bank MSB, bank LSB, PC
+
+  const Mode& mode(uint8_t presetMode);
+  uint16_t    presets(uint8_t presetMode);   // resolves the Axe-FX model
+
+  // Messages for `preset` (kinds 0xB0 / 0xC0, channel from the sinks), or
+  // 0 when out of range. lastBank < 0: bank unknown, always sent.
+  uint8_t plan(const Mode& m, uint16_t presets, uint16_t preset, int32_t lastBank, midi_out::Msg* out);
+
+  // Current preset mode. Bank select is skipped while the bank is unchanged;
+  // a mode switch or a new BLE connection makes it unknown again.
+  bool     select(uint16_t preset);
+  bool     scene(uint8_t scene);          // 1..scenes
+  uint16_t current();                     // last preset selected (clamped to the range)
+  uint16_t step(uint16_t from, int16_t delta);   // round robin within the range
+  void     format(uint16_t preset, char* out, size_t n);
+  void     forgetBank();
+
+  // What the receiver has loaded: mode << 24 | preset << 8 | scene (0 = as
+  // the preset loaded). changes() counts every select() / scene() sent, so a
+  // reload of the same preset is seen too.
+  static constexpr uint32_t NO_LOCATION = 0xFFFFFFFFUL;   // nothing selected yet
+  uint32_t location();
+  uint16_t changes();
+
+  void printState(Print& out = Serial);
+}
@@ -0,0 +1,132 @@
+// =============================
+// File: src/render_profiler.cpp
+// =============================
+#include "render_profiler.h"
+#include <stdlib.h>
+#include <string.h>
+#include "layout_constants.h"
+
+namespace {
+  // ST77xx window setup: CASET(1+4) + RASET(1+4) + RAMWR(1)
+  static constexpr uint32_t WINDOW_SETUP_BYTES = 11;
+  static constexpr uint8_t  HEAT_CELL = 4;
+
+  static bool     s_capturing = false;
+  static bool     s_heatOn    = false;
+  static uint8_t* s_heat      = nullptr;   // SCREEN_W * SCREEN_H, saturating
+  static uint8_t  s_depth     = 0;
+  static render_profiler::Stats s_stats;
+
+  static const char* const PRIM_NAMES[render_profiler::PRIM_COUNT] = {
+    "px", "hln", "vln", "fill", "rect", "line", "tri", "scr", "chr", "blit", "cmd"
+  };
+
+  inline void padTo(Print& out, size_t printed, size_t width) {
+    while (printed++ < width) out.print(' ');
+  }
+}
+
+namespace render_profiler {
+
+bool begin(bool withHeatmap) {
+  memset(&s_stats, 0, sizeof(s_stats));
+  s_depth = 0;
+  s_heatOn = false;
+  if (withHeatmap) {
+    if (!s_heat) s_heat = (uint8_t*)malloc((size_t)SCREEN_W * SCREEN_H);
+    if (s_heat) { memset(s_heat, 0, (size_t)SCREEN_W * SCREEN_H); s_heatOn = true; }
+  }
+  s_capturing = true;
+  return !withHeatmap || s_heatOn;
+}
+
+void end(Stats& out) {
+  s_capturing = false;
+  if (s_heatOn) {
+    for (size_t i = 0; i < (size_t)SCREEN_W * SCREEN_H; ++i) {
+      const uint8_t n = s_heat[i];
+      if (n > s_stats.maxOverdraw) s_stats.maxOverdraw = n;
+      if (n > 1) ++s_stats.overdrawnPixels;
+    }
+  }
+  out = s_stats;
+}
+
+bool capturing() { return s_capturing; }
+
+void release() {
+  free(s_heat);
+  s_heat = nullptr;
+  s_heatOn = false;
+}
+
+void enter(Prim p) {
+  if (s_capturing && s_depth == 0) ++s_stats.calls[p];
+  ++s_depth;
+}
+
+void leave() { if (s_depth) --s_depth; }
+
+void noteWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (!s_capturing || w <= 0 || h <= 0) return;
+  const uint32_t n = (uint32_t)w * (uint32_t)h;
+  ++s_stats.windows;
+  s_stats.pixels   += n;
+  s_stats.spiBytes += WINDOW_SETUP_BYTES + 2 * n;
+
+  if (!s_heatOn) return;
+  const int16_t x0 = max<int16_t>(x, 0), y0 = max<int16_t>(y, 0);
+  const int16_t x1 = min<int16_t>(x + w, SCREEN_W), y1 = min<int16_t>(y + h, SCREEN_H);
+  for (int16_t yy = y0; yy < y1; ++yy) {
+    uint8_t* row = s_heat + (size_t)yy * SCREEN_W;
+    for (int16_t xx = x0; xx < x1; ++xx) if (row[xx] != 0xFF) ++row[xx];
+  }
+}
+
+void noteCommand(uint8_t dataBytes) {
+  if (!s_capturing) return;
+  s_stats.spiBytes += 1u + dataBytes;
+}
+
+void printTableHeader(Print& out) {
+  out.print(F("screen / transition             calls  pixels  win   spiB   maxOD  od_px  "));
+  for (uint8_t p = 0; p < PRIM_COUNT; ++p) { out.print(PRIM_NAMES[p]); out.print(' '); }
+  out.println();
+}
+
+void printTableRow(Print& out, const char* label, const Stats& s) {
+  uint32_t calls = 0;
+  for (uint8_t p = 0; p < PRIM_COUNT; ++p) calls += s.calls[p];
+  out.print(label);                       // any length; numbers start at column 33
+  padTo(out, strlen(label), 33);
+  char buf[128];
+  snprintf(buf, sizeof(buf), "%5lu %7lu %4lu %6lu %6u %6lu  ",
+                         (unsigned long)calls, (unsigned long)s.pixels,
+                         (unsigned long)s.windows, (unsigned long)s.spiBytes,
+                         (unsigned)s.maxOverdraw, (unsigned long)s.overdrawnPixels);
+  out.print(buf);
+  for (uint8_t p = 0; p < PRIM_COUNT; ++p) {
+    const int w = snprintf(buf, sizeof(buf), "%lu", (unsigned long)s.calls[p]);
+    out.print(buf);
+    padTo(out, (size_t)w, strlen(PRIM_NAMES[p]) + 1);
+  }
+  out.println();
+}
+
+void printHeatmap(Print& out) {
+  if (!s_heat) { out.println(F("[prof] no heatmap captured")); return; }
+  for (int16_t cy = 0; cy < SCREEN_H; cy += HEAT_CELL) {
+    char line[SCREEN_W / HEAT_CELL + 1];
+    uint8_t col = 0;
+    for (int16_t cx = 0; cx < SCREEN_W; cx += HEAT_CELL) {
+      uint8_t m = 0;
+      for (int16_t y = cy; y < min<int16_t>(cy + HEAT_CELL, SCREEN_H); ++y)
+        for (int16_t x = cx; x < cx + HEAT_CELL; ++x) m = max(m, s_heat[(size_t)y * SCREEN_W + x]);
+      line[col++] = (m == 0) ? '.' : (m > 9 ? '+' : (char)('0' + m));
+    }
+    line[col] = 0;
+    out.println(line);
+  }
+}
+
+} // namespace render_profiler
@@ -0,0 +1,43 @@
+// =============================
+// File: src/render_profiler.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// Counts what a screen costs on the wire: draw calls by primitive, pixels
+// written, address-window switches and SPI bytes, plus an optional per-pixel
+// overdraw heatmap for one capture. The counting core only needs Print, so it
+// can be fed from a host build; on device it is driven by profiled_tft.h.
+namespace render_profiler {
+  enum Prim : uint8_t {
+    PRIM_PIXEL, PRIM_HLINE, PRIM_VLINE, PRIM_FILL_RECT, PRIM_RECT, PRIM_LINE,
+    PRIM_TRIANGLE, PRIM_FILL_SCREEN, PRIM_CHAR, PRIM_PIXELS, PRIM_COMMAND,
+    PRIM_COUNT
+  };
+
+  struct Stats {
+    uint32_t calls[PRIM_COUNT];
+    uint32_t pixels;           // pixels pushed through address windows
+    uint32_t windows;          // CASET/RASET/RAMWR switches
+    uint32_t spiBytes;         // commands + window setup + pixel data
+    uint16_t maxOverdraw;      // most writes to any one pixel (heatmap only)
+    uint32_t overdrawnPixels;  // pixels written more than once (heatmap only)
+  };
+
+  // Capture lifecycle. begin() allocates the 240x135 heatmap on first use.
+  bool begin(bool withHeatmap = true);
+  void end(Stats& out);
+  bool capturing();
+  void release();              // free the heatmap
+
+  // Hooks called by the instrumented panel
+  void enter(Prim p);          // counts the outermost primitive only
+  void leave();
+  void noteWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+  void noteCommand(uint8_t dataBytes);
+
+  // Reporting
+  void printTableHeader(Print& out);
+  void printTableRow(Print& out, const char* label, const Stats& s);
+  void printHeatmap(Print& out); // last capture, 4x4 cells, digit = max writes
+}
@@ -0,0 +1,118 @@
+// =============================
+// File: src/screen_profile.cpp
+// =============================
+#include "screen_profile.h"
+#include "render_profiler.h"
+#include "setup_module.h"
+#include "settings_module.h"
+#include "mode_manager.h"
+
+namespace {
+  enum class Act : uint8_t { BEGIN, TURN_UP, TURN_DOWN, PRESS };
+
+  struct Step { Act act; const char* label; };
+
+  // Root order: BATTERY -> LED -> TFT -> MIRROR -> MIDI_CH -> FADER_CC -> STOMP_CC -> BATTERY.
+  // Edit steps go down then up (or up then down) so values end where they started.
+  static const Step WALK[] = {
+    { Act::BEGIN,     "enter setup (BATTERY)" },
+    { Act::TURN_UP,   "BATTERY -> LED" },
+    { Act::PRESS,     "LED -> LED_BRIGHTNESS" },
+    { Act::TURN_DOWN, "LED_BRIGHTNESS step -" },
+    { Act::TURN_UP,   "LED_BRIGHTNESS step +" },
+    { Act::PRESS,     "LED_BRIGHTNESS -> LED" },
+    { Act::TURN_UP,   "LED -> TFT" },
+    { Act::PRESS,     "TFT -> TFT_BRIGHTNESS" },
+    { Act::TURN_DOWN, "TFT_BRIGHTNESS step -" },
+    { Act::TURN_UP,   "TFT_BRIGHTNESS step +" },
+    { Act::PRESS,     "TFT_BRIGHTNESS -> TFT" },
+    { Act::TURN_UP,   "TFT -> MIRROR" },
+    { Act::PRESS,     "MIRROR -> MIRROR_EDIT" },
+    { Act::TURN_UP,   "MIRROR_EDIT step +" },
+    { Act::TURN_DOWN, "MIRROR_EDIT step -" },
+    { Act::PRESS,     "MIRROR_EDIT -> MIRROR" },
+    { Act::TURN_UP,   "MIRROR -> MIDI_CH" },
+    { Act::PRESS,     "MIDI_CH -> MIDI_CH_SELECT" },
+    { Act::TURN_UP,   "MIDI_CH_SELECT step" },
+    { Act::TURN_DOWN, "MIDI_CH_SELECT step back" },
+    { Act::PRESS,     "MIDI_CH_SELECT -> EDIT" },
+    { Act::TURN_UP,   "MIDI_CH_EDIT step +" },
+    { Act::TURN_DOWN, "MIDI_CH_EDIT step -" },
+    { Act::PRESS,     "MIDI_CH_EDIT -> MIDI_CH" },
+    { Act::TURN_UP,   "MIDI_CH -> FADER_CC" },
+    { Act::PRESS,     "FADER_CC -> FADER_CC_SELECT" },
+    { Act::TURN_UP,   "FADER_CC_SELECT step" },
+    { Act::TURN_DOWN, "FADER_CC_SELECT step back" },
+    { Act::PRESS,     "FADER_CC_SELECT -> EDIT" },
+    { Act::TURN_UP,   "FADER_CC_EDIT step +" },
+    { Act::TURN_DOWN, "FADER_CC_EDIT step -" },
+    { Act::PRESS,     "FADER_CC_EDIT -> FADER_CC" },
+    { Act::TURN_UP,   "FADER_CC -> STOMP_CC" },
+    { Act::PRESS,     "STOMP_CC -> STOMP_CC_SELECT" },
+    { Act::TURN_UP,   "STOMP_CC_SELECT step" },
+    { Act::TURN_DOWN, "STOMP_CC_SELECT step back" },
+    { Act::PRESS,     "STOMP_CC_SELECT -> EDIT" },
+    { Act::TURN_UP,   "STOMP_CC_EDIT step +" },
+    { Act::TURN_DOWN, "STOMP_CC_EDIT step -" },
+    { Act::PRESS,     "STOMP_CC_EDIT -> STOMP_CC" },
+    { Act::TURN_UP,   "STOMP_CC -> BATTERY" },
+  };
+
+  struct Snapshot {
+    uint8_t led, tft, ble, din, faderCC[4], stompCC[4];
+    float   mirror;
+  };
+
+  void take(Snapshot& s) {
+    s.led = settings_module::getLedBrightness();
+    s.tft = settings_module::getTftBrightness();
+    s.ble = settings_module::getBleMidiChannel();
+    s.din = settings_module::getDinMidiChannel();
+    s.mirror = settings_module::getMirrorDelay();
+    for (uint8_t i = 0; i < 4; ++i) { s.faderCC[i] = settings_module::getFaderCC(i); s.stompCC[i] = settings_module::getStompCC(i); }
+  }
+
+  // Clamped edits (e.g. brightness already at 20) can drift by one step
+  void restore(const Snapshot& s) {
+    if (settings_module::getLedBrightness() != s.led) settings_module::setLedBrightness(s.led);
+    if (settings_module::getTftBrightness() != s.tft) settings_module::setTftBrightness(s.tft);
+    if (settings_module::getBleMidiChannel() != s.ble) settings_module::setBleMidiChannel(s.ble);
+    if (settings_module::getDinMidiChannel() != s.din) settings_module::setDinMidiChannel(s.din);
+    if (settings_module::getMirrorDelay() != s.mirror) settings_module::setMirrorDelay(s.mirror);
+    for (uint8_t i = 0; i < 4; ++i) {
+      if (settings_module::getFaderCC(i) != s.faderCC[i]) settings_module::setFaderCC(i, s.faderCC[i]);
+      if (settings_module::getStompCC(i) != s.stompCC[i]) settings_module::setStompCC(i, s.stompCC[i]);
+    }
+  }
+
+  void perform(Act a) {
+    switch (a) {
+      case Act::BEGIN:     setup_module::begin(); break;
+      case Act::TURN_UP:   setup_module::onEncoderTurn(+1); break;
+      case Act::TURN_DOWN: setup_module::onEncoderTurn(-1); break;
+      case Act::PRESS:     setup_module::onEncoderPress(); break;
+    }
+  }
+}
+
+void screen_profile::run(Print& out) {
+  Snapshot snap; take(snap);
+
+  render_profiler::printTableHeader(out);
+  render_profiler::Stats s, total = {};
+  for (const Step& step : WALK) {
+    render_profiler::begin(true);
+    perform(step.act);
+    render_profiler::end(s);
+    render_profiler::printTableRow(out, step.label, s);
+
+    for (uint8_t p = 0; p < render_profiler::PRIM_COUNT; ++p) total.calls[p] += s.calls[p];
+    total.pixels += s.pixels; total.windows += s.windows; total.spiBytes += s.spiBytes;
+    total.overdrawnPixels += s.overdrawnPixels;
+    if (s.maxOverdraw > total.maxOverdraw) total.maxOverdraw = s.maxOverdraw;
+  }
+  render_profiler::printTableRow(out, "TOTAL", total);
+
+  restore(snap);
+  mode_manager::redraw();   // back to the mode the walk started from, restored values
+}
@@ -0,0 +1,13 @@
+// =============================
+// File: src/screen_profile.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// Walks every setup_* screen and transition through the normal input hooks,
+// capturing render_profiler stats per step, and prints the cost table.
+// Settings touched by the walk are snapshotted and restored afterwards, and
+// the screen of the mode it started from (setup or play) is redrawn.
+namespace screen_profile {
+  void run(Print& out = Serial);
+}
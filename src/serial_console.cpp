@@ -0,0 +1,233 @@
+// =============================
+// File: src/serial_console.cpp
+// =============================
+#include "serial_console.h"
+#include <string.h>
+#include "render_profiler.h"
+#include "screen_profile.h"
+#include "midi_monitor.h"
+#include "display_module.h"
+#include "brightness_module.h"
+#include "settings_module.h"
+#include "settings_transfer.h"
+#include "boot_profile.h"
+#include "module_manager.h"
+#include "midi_din.h"
+#include "midi_wire_sim.h"
+#include "midi_ble.h"
+#include "midi_out.h"
+#include "ble_midi_packet.h"
+#include "tempo_module.h"
+#include "program_change.h"
+#include "fader_module.h"
+#include "mirror_module.h"
+#include "mode_manager.h"
+
+namespace {
+  static constexpr size_t LINE_MAX = 96;
+  static char   s_line[LINE_MAX];
+  static size_t s_len = 0;
+  static bool   s_overflow = false;
+
+  typedef void (*CmdFn)(const char* args);
+  struct Command { const char* name; CmdFn fn; const char* help; };
+
+  void cmdHelp(const char* args);
+
+  // prof            walk every setup screen/transition and print the cost table
+  // prof start|stop capture live interaction; stop prints one row
+  // prof heat       overdraw heatmap of the last capture
+  void cmdProf(const char* args) {
+    if (!*args) { screen_profile::run(Serial); return; }
+    if (!strcmp(args, "start")) { render_profiler::begin(true); Serial.println(F("[prof] capturing")); return; }
+    if (!strcmp(args, "stop")) {
+      render_profiler::Stats s; render_profiler::end(s);
+      render_profiler::printTableHeader(Serial);
+      render_profiler::printTableRow(Serial, "live capture", s);
+      return;
+    }
+    if (!strcmp(args, "heat")) { render_profiler::printHeatmap(Serial); return; }
+    if (!strcmp(args, "free")) { render_profiler::release(); return; }
+    Serial.println(F("[prof] usage: prof [start|stop|heat|free]"));
+  }
+
+  void cmdMon(const char* /*args*/) {
+    if (midi_monitor::active()) {
+      midi_monitor::printStats(Serial);
+      midi_monitor::hide();
+      mode_manager::redraw();
+    } else {
+      midi_monitor::show();
+    }
+  }
+
+  // sleep        panel sleep count and wake latency
+  // sleep <sec>  set the idle time before backlight off + panel sleep
+  void cmdSleep(const char* args) {
+    if (*args) {
+      const long sec = atol(args);
+      if (sec > 0) {
+        const uint32_t offMs = (uint32_t)sec * 1000UL;
+        brightness_module::setIdleTimeouts(brightness_module::dimAfterMs(), offMs);
+      }
+    }
+    const uint32_t dimMs = brightness_module::dimAfterMs(), offMs = brightness_module::offAfterMs();
+    Serial.print(F("[display] dim after ms=")); Serial.print(dimMs < offMs ? dimMs : offMs);
+    Serial.print(F(" off/sleep after ms="));   Serial.println(offMs);
+    display_module::printSleepStats(Serial);
+  }
+
+  // cfg          human-readable dump
+  // cfg flush    commit pending edits first
+  // cfg export   framed image; sending it back imports it (see settings_transfer.h)
+  // cfg i ...    one framed import line
+  void cmdCfg(const char* args) {
+    if (!strncmp(args, "i ", 2)) { settings_transfer::importLine(args + 2, Serial); return; }
+    if (!strcmp(args, "export")) { settings_transfer::exportTo(Serial); return; }
+    if (!strcmp(args, "flush")) settings_module::flushNow();
+    settings_module::dumpToSerial(Serial);
+  }
+
+  void cmdBoot(const char* /*args*/) {
+    boot_profile::printReport(Serial);
+    Serial.println(F("[boot] module order:"));
+    module_manager::printOrder(Serial);
+  }
+
+  // midi      transport stats
+  // midi sim  wire-time model of fader/stomp traffic, FIFO vs coalesced
+  // midi ble  BLE-MIDI packetizer loopback
+  void cmdMidi(const char* args) {
+    if (!strcmp(args, "sim")) { midi_wire_sim::run(Serial); return; }
+    if (!strcmp(args, "ble")) { ble_midi_packet::loopback(Serial); return; }
+    midi_out::printStats(Serial);
+    fader_module::printStats(Serial);
+    mirror_module::printStats(Serial);
+    midi_din::printStats(Serial);
+    midi_ble::printStats(Serial);
+  }
+
+  // pc            preset mode, range and bank state
+  // pc <n>        select preset n (0-based index into the mode's range)
+  // pc scene <n>  snapshot / scene n (1-based)
+  // pc axe 2|3    Axe-FX II (384 presets) or III / FM (512)
+  void cmdPc(const char* args) {
+    if (!strncmp(args, "scene ", 6)) {
+      if (!program_change::scene((uint8_t)atoi(args + 6))) Serial.println(F("[pc] no such scene"));
+    } else if (!strncmp(args, "axe ", 4)) {
+      const int m = atoi(args + 4);
+      if (m == 2 || m == 3) settings_module::setAxeModel(m == 2 ? settings_module::AXE_FX_II : settings_module::AXE_FX_III);
+      else Serial.println(F("[pc] usage: pc axe 2|3"));
+    } else if (*args) {
+      const long n = atol(args);
+      if (n < 0 || n > 0xFFFF || !program_change::select((uint16_t)n)) Serial.println(F("[pc] out of range / queue full"));
+    }
+    program_change::printState(Serial);
+  }
+
+  // fader                         per-fader CC and resolution
+  // fader res <n> 7|14|nrpn [msb]  fader n (1-4) as a 7-bit CC, a 14-bit CC
+  //                                pair (cc + 32 = LSB) or NRPN msb:cc
+  void cmdFader(const char* args) {
+    if (!strncmp(args, "res ", 4)) {
+      char* end = nullptr;
+      const long n = strtol(args + 4, &end, 10);
+      while (end && *end == ' ') ++end;
+      uint8_t res = 0xFF;
+      if (end && !strncmp(end, "nrpn", 4))    { res = settings_module::FADER_RES_NRPN; end += 4; }
+      else if (end && !strncmp(end, "14", 2)) { res = settings_module::FADER_RES_14BIT_CC; end += 2; }
+      else if (end && *end == '7')            { res = settings_module::FADER_RES_7BIT; end += 1; }
+      if (n < 1 || n > 4 || res == 0xFF || (end && *end && *end != ' ')) {
+        Serial.println(F("[fader] usage: fader res <1-4> 7|14|nrpn [msb]"));
+        return;
+      }
+      settings_module::setFaderRes((uint8_t)(n - 1), res);
+      while (*end == ' ') ++end;
+      if (*end) {
+        const long msb = atol(end);
+        if (res == settings_module::FADER_RES_NRPN && msb >= 0 && msb <= 127) settings_module::setFaderNrpnMsb((uint8_t)(n - 1), (uint8_t)msb);
+        else Serial.println(F("[fader] msb is 0-127, nrpn only"));
+      }
+    } else if (*args) {
+      Serial.println(F("[fader] usage: fader | fader res <1-4> 7|14|nrpn [msb]"));
+      return;
+    }
+    for (uint8_t i = 0; i < 4; ++i) {
+      const uint8_t res = settings_module::getFaderRes(i);
+      Serial.print(F("  F")); Serial.print(i + 1);
+      Serial.print(F(" cc=")); Serial.print(settings_module::getFaderCC(i));
+      if (res == settings_module::FADER_RES_NRPN) {
+        Serial.print(F(" nrpn msb=")); Serial.println(settings_module::getFaderNrpnMsb(i));
+      } else {
+        Serial.println(res == settings_module::FADER_RES_14BIT_CC ? F(" 14-bit") : F(" 7-bit"));
+      }
+    }
+  }
+
+  // tempo              clock state and tap stats
+  // tempo <bpm>        set the tempo (30-240; 0 turns the clock off)
+  // tempo start|stop|continue
+  // tempo sim          clock jitter, timer ISR vs loop-polled, plus a tap replay
+  void cmdTempo(const char* args) {
+    if (!strcmp(args, "sim"))      { midi_wire_sim::clock(Serial); return; }
+    if (!strcmp(args, "start"))    tempo_module::start();
+    else if (!strcmp(args, "stop")) tempo_module::stop();
+    else if (!strcmp(args, "continue")) tempo_module::resume();
+    else if (*args) tempo_module::setBpm((float)atof(args));
+    tempo_module::printStats(Serial);
+  }
+
+  static const Command COMMANDS[] = {
+    { "help", cmdHelp, "list commands" },
+    { "prof", cmdProf, "render cost: prof | prof start|stop|heat|free" },
+    { "mon",  cmdMon,  "toggle the scrolling MIDI monitor" },
+    { "sleep", cmdSleep, "panel sleep stats | sleep <sec> sets idle timeout" },
+    { "midi", cmdMidi, "MIDI output stats | midi sim | midi ble" },
+    { "tempo", cmdTempo, "clock + tap stats | tempo <bpm> | tempo start|stop|continue | tempo sim" },
+    { "pc",   cmdPc,   "preset state | pc <n> | pc scene <n> | pc axe 2|3" },
+    { "fader", cmdFader, "fader CC/resolution | fader res <n> 7|14|nrpn [msb]" },
+    { "boot", cmdBoot, "boot milestone times (esp_timer) + module order" },
+    { "cfg",  cmdCfg,  "dump settings + NVS write stats | cfg flush | cfg export" },
+  };
+  static constexpr size_t COMMAND_COUNT = sizeof(COMMANDS) / sizeof(COMMANDS[0]);
+
+  void cmdHelp(const char* /*args*/) {
+    for (size_t i = 0; i < COMMAND_COUNT; ++i) {
+      Serial.print(F("  ")); Serial.print(COMMANDS[i].name);
+      Serial.print(F(" - ")); Serial.println(COMMANDS[i].help);
+    }
+  }
+
+  void dispatch(char* line) {
+    while (*line == ' ') ++line;
+    if (!*line) return;
+    char* args = strchr(line, ' ');
+    if (args) { *args++ = 0; while (*args == ' ') ++args; } else { args = line + strlen(line); }
+
+    for (size_t i = 0; i < COMMAND_COUNT; ++i) {
+      if (!strcmp(line, COMMANDS[i].name)) { COMMANDS[i].fn(args); return; }
+    }
+    Serial.print(F("[console] unknown command: ")); Serial.println(line);
+  }
+}
+
+void serial_console::begin() {
+  s_len = 0;
+  s_overflow = false;
+}
+
+void serial_console::update() {
+  while (Serial.available() > 0) {
+    const int c = Serial.read();
+    if (c < 0) break;
+    if (c == '\r') continue;
+    if (c == '\n') {
+      s_line[s_len] = 0;
+      if (s_overflow) Serial.println(F("[console] line too long"));
+      else dispatch(s_line);
+      s_len = 0; s_overflow = false;
+      continue;
+    }
+    if (s_len + 1 < LINE_MAX) s_line[s_len++] = (char)c; else s_overflow = true;
+  }
+}
@@ -0,0 +1,12 @@
+// =============================
+// File: src/serial_console.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// Line-based diagnostic commands over the USB Serial port ("help" lists them).
+// Reading is non-blocking; a command runs when its newline arrives.
+namespace serial_console {
+  void begin();
+  void update();
+}
@@ -1,4 +1,59 @@
-// File: settings_module.cpp — persistence lock (v2.3: Stomp CC defaults 80–83)
+// File: settings_module.cpp — persistence lock (v3.8: Axe-FX model)
+// Changes from v3.7:
+//  • Schema 6 appends the Axe-FX model, which sets the preset range
+//    program_change offers in Axe-FX mode (384 or 512).
+// Changes from v3.6:
+//  • Schema 5 appends a per-fader resolution (7-bit CC, 14-bit CC pair or
+//    NRPN) and NRPN parameter MSB. The dirty mask is 64 bits to fit them.
+// Changes from v3.5:
+//  • exportImage()/importImage() move the whole blob in one piece for
+//    settings_transfer. Import checks schema, size, CRC and every field range
+//    before touching anything, then commits one blob (or one snapshot under
+//    the journal backend) and notifies all fields.
+//  • replaceCustom*Labels() rebuild a label pool, writing only changed slots.
+// Changes from v3.4:
+//  • subscribe(mask, fn) registers a callback in a fixed table; every real
+//    change through a setter bumps that field's generation and calls the
+//    subscribers whose mask covers it. A mode switch reports the CC / label
+//    fields with ALL_SLOTS.
+// Changes from v3.3:
+//  • Each preset mode has a constexpr factory profile (fader/stomp CCs, and
+//    labels for Kemper / Axe-FX) in flash, plus a per-mode user overlay in the
+//    blob where 0xFF means "use the profile". Switching mode swaps two
+//    pointers; each mode keeps its own edits and nothing is rewritten in NVS.
+//  • Schema 4 appends the overlays and moves the single set of v3 CC / label
+//    assignments into the overlay of the mode that was active.
+// Changes from v3.2:
+//  • Custom labels live in fixed char pools (16 x 10 chars per kind) with
+//    stable slot ids. Each slot is one key ("cf_<id>" / "cs_<id>"); a small
+//    map blob holds the used bitmap and display order. Getters return
+//    const char*; delete rewrites only the map.
+//  • Schema 3 moves the v2.x "f_lbl_<i>" / "s_lbl_<i>" label strings into the
+//    pools and removes the old keys, ending their clash with label indices.
+// Changes from v3.1:
+//  • SETTINGS_BACKEND_JOURNAL=1 commits edits as 8-byte delta records in a
+//    ring of NVS keys instead of rewriting the blob; the blob becomes a
+//    snapshot that records newer than Blob::journalBase are replayed onto.
+//  • Schema 2 appends Blob::journalBase.
+//  • nvsBytesWritten() estimates flash bytes written (NVS 32-byte entries).
+// Changes from v3.0:
+//  • The blob version is the schema version. begin() runs the ordered steps of
+//    MIGRATIONS from the stored version up to CURRENT_SCHEMA_VERSION exactly
+//    once, commits one blob, then runs each step's cleanup.
+//  • A normal boot is two NVS reads (blob length + blob) and zero writes;
+//    bootNvsReads()/bootNvsWrites() report the counts.
+//  • The CRC now lives in the blob header so later schema steps can append
+//    fields without moving it.
+// Changes from v2.4:
+//  • All scalar/array settings live in one POD (Blob) stored with putBytes
+//    under "cfg", carrying a layout version and CRC32. Boot is one read.
+//  • The per-field keys of v2.x are imported once when no valid blob exists,
+//    then removed. Custom labels keep their own keys for now.
+// Changes from v2.3:
+//  • The RAM cache is the source of truth. Setters only mark a field dirty;
+//    flush() writes every dirty key in one batch after FLUSH_IDLE_MS without
+//    further changes, on leaving setup, before panel sleep, or on flushNow().
+//  • Setters no longer read values back from NVS for debug prints.
 // Changes from v2.2:
 //  • First‑run defaults for STOMP CC are now S1..S4 → 80,81,82,83 (was 24..27).
 //  • If any s_cc_* key exists, we HONOUR stored values and load with a safe default (80) per slot.
@@ -6,27 +61,174 @@
 
 #include "settings_module.h"
 #include <Preferences.h>
+#include <stddef.h>
+#include <string.h>
 
-// Enable detailed persistence diagnostics (prints at boot and on saves)
+// Enable detailed persistence diagnostics (prints at boot and on flush)
 #define SETTINGS_DEBUG 1
 
+#ifndef SETTINGS_FLUSH_IDLE_MS
+#define SETTINGS_FLUSH_IDLE_MS 2000UL // commit once nothing has changed for 2 s
+#endif
+
+// 1 = commit edits as journal records, compacting into the blob when the ring is full
+#ifndef SETTINGS_BACKEND_JOURNAL
+#define SETTINGS_BACKEND_JOURNAL 0
+#endif
+
 namespace settings_module {
   // -------- constants / helpers --------
-  static Preferences prefs;
+  // Preferences with an op counter, so boot cost is visible on the device
+  class CountedPrefs : public Preferences {
+  public:
+    uint32_t reads = 0, writes = 0;
+    uint8_t  getUChar(const char* k, uint8_t d = 0)        { ++reads;  return Preferences::getUChar(k, d); }
+    size_t   putUChar(const char* k, uint8_t v)            { ++writes; return Preferences::putUChar(k, v); }
+    uint32_t getUInt(const char* k, uint32_t d = 0)        { ++reads;  return Preferences::getUInt(k, d); }
+    float    getFloat(const char* k, float d = 0)          { ++reads;  return Preferences::getFloat(k, d); }
+    uint64_t getULong64(const char* k, uint64_t d = 0)     { ++reads;  return Preferences::getULong64(k, d); }
+    size_t   putULong64(const char* k, uint64_t v)         { ++writes; return Preferences::putULong64(k, v); }
+    bool     isKey(const char* k)                          { ++reads;  return Preferences::isKey(k); }
+    bool     remove(const char* k)                         { ++writes; return Preferences::remove(k); }
+    size_t   getBytesLength(const char* k)                 { ++reads;  return Preferences::getBytesLength(k); }
+    size_t   getBytes(const char* k, void* b, size_t n)    { ++reads;  return Preferences::getBytes(k, b, n); }
+    size_t   putBytes(const char* k, const void* b, size_t n) { ++writes; return Preferences::putBytes(k, b, n); }
+    size_t   getString(const char* k, char* b, size_t n)   { ++reads;  return Preferences::getString(k, b, n); }
+    size_t   putString(const char* k, const char* v)       { ++writes; return Preferences::putString(k, v); }
+  };
+  static CountedPrefs prefs;
   static constexpr const char* NAMESPACE = "setup";
-  static constexpr uint32_t CURRENT_SCHEMA_VERSION = 1; // bump when storage layout changes
 
   template <typename T>
   static inline T clampT(T v, T lo, T hi) { return (v < lo) ? lo : (v > hi ? hi : v); }
 
-  // Keys (ALL <= 15 chars!)
+  // Persistent settings, stored as one NVS blob
+  static constexpr const char* KEY_BLOB                = "cfg";
+  static constexpr uint16_t    CURRENT_SCHEMA_VERSION  = 6; // bump + add a MIGRATIONS step when Blob changes
+  static constexpr size_t      MAX_BLOB_BYTES          = IMAGE_MAX_BYTES;
+
+  // -------- preset mode profiles (flash) --------
+  struct ModeProfile {
+    const char* name;
+    uint8_t     faderCC[4];
+    uint8_t     stompCC[4];
+    const char* faderLabel[4];   // nullptr: labels are left to the user (MIDI Learn modes)
+    const char* stompLabel[4];
+  };
+
+  // preset_mode_list order; the index is the stored preset mode
+  static constexpr ModeProfile PROFILES[PRESET_MODE_COUNT] = {
+    { "0-127",     {20,21,22,23}, {80,81,82,83}, {}, {} },
+    { "1-128",     {20,21,22,23}, {80,81,82,83}, {}, {} },
+    { "Helix",     {20,21,22,23}, {80,81,82,83}, {}, {} },
+    { "Kemper",    {72, 4,69,71}, {17,18,22,24},
+      { "Amp Gain", "Pitch", "Delay Fdbk", "ReverbTime" },
+      { "Effect A", "Effect B", "FX Slot X", "Mod Slot" } },
+    { "Axe-FX",    {20,21,22,23}, {80,81,82,83},
+      { "CC20", "CC21", "CC22", "CC23" },
+      { "CC80", "CC81", "CC82", "CC83" } },
+    { "Bias-FX",   {20,21,22,23}, {80,81,82,83}, {}, {} },
+    { "AmpliTube", {20,21,22,23}, {80,81,82,83}, {}, {} },
+    { "JamUp",     {20,21,22,23}, {80,81,82,83}, {}, {} },
+    { "ToneStack", {20,21,22,23}, {80,81,82,83}, {}, {} },
+    { "Loopy",     {20,21,22,23}, {80,81,82,83}, {}, {} },
+  };
+
+  static constexpr bool labelFits(const char* s) {
+    size_t n = 0;
+    while (s && s[n]) ++n;
+    return n <= LABEL_MAX_LEN;
+  }
+  static constexpr bool profilesAreValid() {
+    for (const ModeProfile& p : PROFILES) {
+      for (uint8_t i = 0; i < 4; ++i) {
+        if (p.faderCC[i] > 127 || p.stompCC[i] > 127) return false;
+        if (!labelFits(p.faderLabel[i]) || !labelFits(p.stompLabel[i])) return false;
+      }
+    }
+    return true;
+  }
+  static_assert(profilesAreValid(), "profile CCs must be 0..127 and labels at most LABEL_MAX_LEN chars");
+
+  // User edits on top of a profile; NO_OVERRIDE falls through to the profile.
+  static constexpr uint8_t NO_OVERRIDE = 0xFF;
+  struct ModeOverlay {
+    uint8_t faderCC[4];
+    uint8_t stompCC[4];
+    uint8_t faderLabelIndex[4];
+    uint8_t stompLabelIndex[4];
+  };
+
+  // Fields are only ever appended; a schema step fills in what it adds.
+  struct Blob {
+    uint16_t version;         // schema version
+    uint16_t size;            // sizeof(Blob) at write time
+    uint32_t crc;             // CRC32 of the bytes after the header
+    uint8_t  bleMidiChannel;  // 1..16
+    uint8_t  dinMidiChannel;  // 1..16
+    uint8_t  presetMode;      // app‑defined
+    uint8_t  ledBrightness;   // 0..20
+    uint8_t  tftBrightness;   // 1..20
+    uint8_t  reserved0;
+    uint16_t mirrorDelayMs;
+    uint8_t  faderLabelIndex[4];  // schema 1-3 assignments; superseded by modes[]
+    uint8_t  faderCC[4];
+    uint8_t  stompLabelIndex[4];
+    uint8_t  stompCC[4];
+    uint8_t  stompType[4];    // 0=momentary, 1=toggle
+    // --- schema 2 ---
+    uint32_t journalBase;     // last journal seq folded into this snapshot
+    // --- schema 4 ---
+    ModeOverlay modes[PRESET_MODE_COUNT];
+    // --- schema 5 ---
+    uint8_t  faderRes[4];     // FaderRes
+    uint8_t  faderNrpnMsb[4]; // 0..127
+    // --- schema 6 ---
+    uint8_t  axeModel;        // AxeModel
+  };
+  // Mirror delay range of the setup screen (0.1 .. 3.0 s); setters and import hold to it
+  static constexpr uint16_t MIRROR_DELAY_MIN_MS = 100;
+  static constexpr uint16_t MIRROR_DELAY_MAX_MS = 3000;
+
+  static constexpr size_t BLOB_HEADER  = offsetof(Blob, bleMidiChannel);
+  static constexpr size_t BLOB_V1_SIZE = offsetof(Blob, journalBase);
+  static constexpr size_t BLOB_V3_SIZE = offsetof(Blob, modes);
+  static constexpr size_t BLOB_V4_SIZE = offsetof(Blob, faderRes);
+  static constexpr size_t BLOB_V5_SIZE = offsetof(Blob, axeModel);
+  static_assert(BLOB_V1_SIZE == 36, "schema 1 layout must not change");
+  static_assert(BLOB_V3_SIZE == 40, "schema 2-3 layout must not change");
+  static_assert(BLOB_V4_SIZE == 200, "schema 4 layout must not change");
+  static_assert(BLOB_V5_SIZE == 208, "schema 5 layout must not change");
+  static_assert(sizeof(Blob) <= MAX_BLOB_BYTES, "settings blob outgrew MAX_BLOB_BYTES");
+
+  static constexpr Blob makeDefaults() {
+    Blob b = {
+      CURRENT_SCHEMA_VERSION, sizeof(Blob), 0,
+      1, 1, 0, 10, 10, 0,
+      250,
+      {0,0,0,0}, {20,21,22,23}, {0,0,0,0}, {80,81,82,83}, {0,0,0,0},
+      0,
+      {},
+      {0,0,0,0}, {0,0,0,0},
+      AXE_FX_III
+    };
+    for (ModeOverlay& o : b.modes) {
+      for (uint8_t i = 0; i < 4; ++i) {
+        o.faderCC[i] = o.stompCC[i] = o.faderLabelIndex[i] = o.stompLabelIndex[i] = NO_OVERRIDE;
+      }
+    }
+    return b;
+  }
+  static constexpr Blob DEFAULTS = makeDefaults();
+
+  // Keys of the v2.x per-field layout (schema 0; read by migrateKeysToBlob)
   static constexpr const char* KEY_SCHEMA_VERSION      = "schema_version"; // 14
   static constexpr const char* KEY_BLE_CH              = "ble_ch";         // 6
   static constexpr const char* KEY_DIN_CH              = "din_ch";         // 6
   static constexpr const char* KEY_PRESET_MODE         = "preset_mode";    // 11
   static constexpr const char* KEY_LED_BRIGHT          = "led_bright";     // 10
   static constexpr const char* KEY_TFT_BRIGHT          = "tft_bright";     // 10
-  static constexpr const char* KEY_MIRROR_DELAY_MS     = "mirror_ms";      // 9 (new short key)
+  static constexpr const char* KEY_MIRROR_DELAY_MS     = "mirror_ms";      // 9 (float ms)
 
   // Short, safe prefixes (<= 15 incl. index when appended)
   static constexpr const char* KEY_FADER_LBL_IDX       = "f_lbl_"; // +i
@@ -35,8 +237,15 @@ namespace settings_module {
   static constexpr const char* KEY_STOMP_CC            = "s_cc_";  // +i
   static constexpr const char* KEY_STOMP_TYPE          = "s_type_";// +i
 
-  static constexpr const char* KEY_CUSTOM_FADER_COUNT  = "f_lbl_n"; // count
+  static constexpr const char* KEY_CUSTOM_FADER_COUNT  = "f_lbl_n"; // count (v2.x labels, schema 3 import)
   static constexpr const char* KEY_CUSTOM_STOMP_COUNT  = "s_lbl_n"; // count
+  static constexpr uint8_t     V2_MAX_CUSTOM_LABELS    = 8;
+
+  // Custom label pools
+  static constexpr const char* KEY_FADER_LABEL         = "cf_";    // +id
+  static constexpr const char* KEY_STOMP_LABEL         = "cs_";    // +id
+  static constexpr const char* KEY_FADER_LABEL_MAP     = "cf_map";
+  static constexpr const char* KEY_STOMP_LABEL_MAP     = "cs_map";
 
   // Legacy keys (read-only migration)
   static constexpr const char* LEGACY_BLE_CH_CAMEL     = "bleMidiChannel";  // 14 (u32)
@@ -44,30 +253,186 @@ namespace settings_module {
   static constexpr const char* LEGACY_MIRROR_DELAY_MS  = "mirror_delay_ms"; // 15 (float ms)
 
   // -------- storage‑backed state (RAM cache) --------
-  static uint8_t schemaVersion = CURRENT_SCHEMA_VERSION;
-  static uint8_t bleMidiChannel = 1;  // 1..16
-  static uint8_t dinMidiChannel = 1;  // 1..16
-  static uint8_t presetMode = 0;      // app‑defined
-  static uint8_t ledBrightness = 10;  // app‑defined step index
-  static uint8_t tftBrightness = 10;  // app‑defined step index
-  static float   mirrorDelay   = 0.25f; // seconds
-
-  static uint8_t faderLabelIndex[4]  = {0,0,0,0};
-  static uint8_t faderCC[4]          = {20,21,22,23};
-  static uint8_t stompLabelIndex[4]  = {0,0,0,0};
-  static uint8_t stompCC[4]          = {80,81,82,83};  // NEW defaults
-  static uint8_t stompType[4]        = {0,0,0,0}; // 0=momentary,1=toggle ... app‑defined
-
-  // Custom labels live in RAM with a persisted count and individual keys
-  static String  customFaderLabels[8];
-  static uint8_t customFaderLabelCount = 0;
-  static String  customStompLabels[8];
-  static uint8_t customStompLabelCount = 0;
+  static Blob s_cfg = DEFAULTS;
+
+  // Active preset mode: switching is a pointer swap (see selectMode)
+  static const ModeProfile* s_profile = &PROFILES[0];
+  static ModeOverlay*       s_overlay = &s_cfg.modes[0];
+
+  static inline uint8_t modeIndex(uint8_t mode) { return (mode < PRESET_MODE_COUNT) ? mode : 0; }
+  static void selectMode() {
+    const uint8_t m = modeIndex(s_cfg.presetMode);
+    s_profile = &PROFILES[m];
+    s_overlay = &s_cfg.modes[m];
+  }
+  static inline uint8_t resolve(uint8_t overlay, uint8_t profile) { return (overlay == NO_OVERRIDE) ? profile : overlay; }
+
+  // Custom labels: fixed slots with stable ids, listed in `order`
+  struct LabelMap {
+    uint16_t used;                        // bit per slot id
+    uint8_t  count;
+    uint8_t  order[MAX_CUSTOM_LABELS];    // display index -> slot id
+  };
+  static_assert(MAX_CUSTOM_LABELS <= 16, "LabelMap::used is 16 bits");
+
+  struct LabelPool {
+    const char* keyPrefix;
+    const char* mapKey;
+    LabelMap    map;
+    char        text[MAX_CUSTOM_LABELS][LABEL_MAX_LEN + 1];
+  };
+  static LabelPool s_faderLabels = { KEY_FADER_LABEL, KEY_FADER_LABEL_MAP, {}, {} };
+  static LabelPool s_stompLabels = { KEY_STOMP_LABEL, KEY_STOMP_LABEL_MAP, {}, {} };
+
+  // -------- dirty tracking --------
+  // One bit per setting: scalars take one bit, the 4-slot arrays four.
+  static constexpr uint8_t FIELD_BIT[(uint8_t)Field::Count] = {
+    0, 1, 2, 3, 4, 5,   // BleChannel .. MirrorDelay
+    6, 10, 14, 18, 22,  // FaderLabelIndex, FaderCC, StompLabelIndex, StompCC, StompType
+    26, 30,             // FaderRes, FaderNrpnMsb
+    34                  // AxeModel
+  };
+  static_assert(34 + 1 <= 64, "dirty mask overflow");
+
+  static bool          s_begun       = false;
+  static uint64_t      s_dirty       = 0;
+  static unsigned long s_lastChange  = 0;
+  static uint32_t      s_setterCalls = 0;   // every set*() call that reached the cache
+  static uint32_t      s_nvsWrites   = 0;   // every NVS write after boot: flushes, label pools, imports
+  static uint32_t      s_nvsBytes    = 0;   // flash bytes those writes cost (estimate)
+  static uint32_t      s_flushes     = 0;
+  static uint32_t      s_bootReads   = 0;
+  static uint32_t      s_bootWrites  = 0;
+
+  static inline uint64_t bitFor(Field f, uint8_t i = 0) { return 1ULL << (FIELD_BIT[(uint8_t)f] + i); }
+
+  // Label pool edits and imports are written through, not batched: each write
+  // also counts as the call that caused it, so it saves nothing either way.
+  static inline void countWriteThrough(uint32_t n) { s_nvsWrites += n; s_setterCalls += n; }
+
+  // -------- change notification --------
+  static_assert((uint8_t)Field::Count <= 16, "field masks are 16 bits");
+  struct Subscriber { uint16_t mask; ChangeFn fn; };
+  static Subscriber s_subs[MAX_SUBSCRIBERS];
+  static uint8_t    s_subCount = 0;
+  static uint16_t   s_gen[(uint8_t)Field::Count];
+  static uint8_t    s_quiet    = 0;   // > 0: changes invisible to consumers (see applyPresetDefaults)
+
+  static void notify(Field f, uint8_t i) {
+    if (s_quiet) return;
+    ++s_gen[(uint8_t)f];
+    for (uint8_t k = 0; k < s_subCount; ++k) {
+      if (s_subs[k].mask & maskOf(f)) s_subs[k].fn(f, i);
+    }
+  }
+
+  // Update the cache; only a real change marks the key dirty.
+  template <typename T>
+  static inline void stage(T& slot, T v, Field f, uint8_t i = 0) {
+    ++s_setterCalls;
+    if (slot == v) return;
+    slot = v;
+    s_dirty |= bitFor(f, i);
+    s_lastChange = millis();
+    notify(f, i);
+  }
 
   // -------- internal helpers --------
   static inline uint8_t readU8(const char* key, uint8_t defv) { return prefs.getUChar(key, defv); }
   static inline void     writeU8(const char* key, uint8_t v)  { prefs.putUChar(key, v); }
 
+  static uint32_t crc32(const uint8_t* p, size_t n) {
+    uint32_t c = 0xFFFFFFFFUL;
+    while (n--) {
+      c ^= *p++;
+      for (uint8_t k = 0; k < 8; ++k) c = (c >> 1) ^ (0xEDB88320UL & (0UL - (c & 1)));
+    }
+    return ~c;
+  }
+  static inline uint32_t payloadCrc(const uint8_t* raw, size_t len) {
+    return crc32(raw + BLOB_HEADER, len - BLOB_HEADER);
+  }
+
+  // Reads the stored blob as raw bytes. Returns its schema version, or 0 when
+  // there is no usable blob (missing, truncated or CRC mismatch).
+  static uint16_t readStored(uint8_t* raw, size_t& len) {
+    len = prefs.getBytesLength(KEY_BLOB);
+    if (len < BLOB_HEADER || len > MAX_BLOB_BYTES) { len = 0; return 0; }
+    if (prefs.getBytes(KEY_BLOB, raw, len) != len) { len = 0; return 0; }
+    const Blob* hdr = (const Blob*)raw;
+    if (hdr->size != len || hdr->version == 0 || hdr->crc != payloadCrc(raw, len)) { len = 0; return 0; }
+    return hdr->version;
+  }
+
+  // NVS stores every item in 32-byte entries; a blob is a data header, its
+  // payload entries and an index entry.
+  static constexpr uint32_t NVS_ENTRY = 32;
+  static constexpr uint32_t nvsBlobCost(size_t len) { return NVS_ENTRY * (2 + (len + NVS_ENTRY - 1) / NVS_ENTRY); }
+
+  static void writeBlob() {
+    s_cfg.version = CURRENT_SCHEMA_VERSION;
+    s_cfg.size    = sizeof(Blob);
+    s_cfg.crc     = payloadCrc((const uint8_t*)&s_cfg, sizeof(Blob));
+    prefs.putBytes(KEY_BLOB, &s_cfg, sizeof(Blob));
+    s_nvsBytes += nvsBlobCost(sizeof(Blob));
+  }
+
+#if SETTINGS_BACKEND_JOURNAL
+  // -------- field access by id (journal records) --------
+  // CC and label fields live in the per-mode overlays; their index is
+  // mode * 4 + slot. Schema 1-3 records indexed the old single set (slot only).
+  static bool s_legacyIndices = false;   // set while folding a pre-schema-4 journal
+
+  static inline bool isModeField(Field f) {
+    return f == Field::FaderLabelIndex || f == Field::FaderCC || f == Field::StompLabelIndex || f == Field::StompCC;
+  }
+  static inline uint8_t recordIndex(Field f, uint8_t slot) {
+    return isModeField(f) ? (uint8_t)(modeIndex(s_cfg.presetMode) * 4 + slot) : slot;
+  }
+
+  static uint8_t* u8Field(Blob& b, Field f, uint8_t i) {
+    if (isModeField(f) && !s_legacyIndices) {
+      if (i >= PRESET_MODE_COUNT * 4) return nullptr;
+      ModeOverlay& o = b.modes[i / 4];
+      switch (f) {
+        case Field::FaderLabelIndex: return &o.faderLabelIndex[i % 4];
+        case Field::FaderCC:         return &o.faderCC[i % 4];
+        case Field::StompLabelIndex: return &o.stompLabelIndex[i % 4];
+        default:                     return &o.stompCC[i % 4];
+      }
+    }
+    switch (f) {
+      case Field::BleChannel:      return &b.bleMidiChannel;
+      case Field::DinChannel:      return &b.dinMidiChannel;
+      case Field::PresetMode:      return &b.presetMode;
+      case Field::LedBrightness:   return &b.ledBrightness;
+      case Field::TftBrightness:   return &b.tftBrightness;
+      case Field::AxeModel:        return &b.axeModel;
+      case Field::FaderLabelIndex: return i < 4 ? &b.faderLabelIndex[i] : nullptr;
+      case Field::FaderCC:         return i < 4 ? &b.faderCC[i] : nullptr;
+      case Field::StompLabelIndex: return i < 4 ? &b.stompLabelIndex[i] : nullptr;
+      case Field::StompCC:         return i < 4 ? &b.stompCC[i] : nullptr;
+      case Field::StompType:       return i < 4 ? &b.stompType[i] : nullptr;
+      case Field::FaderRes:        return i < 4 ? &b.faderRes[i] : nullptr;
+      case Field::FaderNrpnMsb:    return i < 4 ? &b.faderNrpnMsb[i] : nullptr;
+      default:                     return nullptr;
+    }
+  }
+  static uint16_t fieldValue(Blob& b, Field f, uint8_t i) {
+    if (f == Field::MirrorDelay) return b.mirrorDelayMs;
+    const uint8_t* p = u8Field(b, f, i);
+    return p ? *p : 0;
+  }
+  static bool setFieldValue(Blob& b, Field f, uint8_t i, uint16_t v) {
+    if (f == Field::MirrorDelay) { b.mirrorDelayMs = v; return true; }
+    uint8_t* p = u8Field(b, f, i);
+    if (!p || v > 0xFF) return false;
+    *p = (uint8_t)v;
+    return true;
+  }
+#endif
+  static inline uint8_t slotsOf(Field f) { return (f >= Field::FaderLabelIndex && f < Field::AxeModel) ? 4 : 1; }
+
   // Migrate channel from short U8 key or legacy camelCase U32 key
   static uint8_t readChannelMigrating(const char* shortKey, const char* legacyCamelKey) {
     // 1) Prefer short U8 key
@@ -83,10 +448,8 @@ namespace settings_module {
         Serial.print(F(" u32=")); Serial.print(u32);
 #endif
         uint8_t migrated = clampT<uint8_t>((uint8_t)u32, 1, 16);
-        prefs.putUChar(shortKey, migrated); // rewrite under short key
 #ifdef SETTINGS_DEBUG
-        Serial.print(F(" -> key=")); Serial.print(shortKey);
-        Serial.print(F(" u8=")); Serial.println(migrated);
+        Serial.print(F(" -> u8=")); Serial.println(migrated);
 #endif
         return migrated;
       }
@@ -101,266 +464,772 @@ namespace settings_module {
       arr[i] = readU8(k.c_str(), defv);
     }
   }
-  static void saveIndexedU8Array(const char* keyPrefix, const uint8_t* arr, size_t n) {
+  static void removeIndexedKeys(const char* keyPrefix, size_t n) {
     for (size_t i = 0; i < n; ++i) {
       String k = String(keyPrefix) + (uint32_t)i;
-      writeU8(k.c_str(), arr[i]);
+      prefs.remove(k.c_str());
     }
   }
 
-  static void loadCustomLabels(const char* countKey, const char* itemPrefix, String* dst, uint8_t& count) {
-    count = readU8(countKey, 0);
-    if (count > 8) count = 8;
-    for (uint8_t i = 0; i < count; ++i) {
-      String k = String(itemPrefix) + i;
-      dst[i] = prefs.getString(k.c_str(), "");
-    }
+  // -------- label pools --------
+  static void labelKey(char* k, size_t n, const char* prefix, uint8_t id) {
+    snprintf(k, n, "%s%u", prefix, (unsigned)id);
   }
-  static void saveCustomLabels(const char* countKey, const char* itemPrefix, const String* src, uint8_t count) {
-    writeU8(countKey, count);
-    for (uint8_t i = 0; i < count; ++i) {
-      String k = String(itemPrefix) + i;
-      prefs.putString(k.c_str(), src[i]);
-    }
-    for (uint8_t i = count; i < 8; ++i) {
-      String k = String(itemPrefix) + i;
-      prefs.remove(k.c_str());
+
+  static void copyLabel(char* dst, const char* src) {
+    strncpy(dst, src ? src : "", LABEL_MAX_LEN);
+    dst[LABEL_MAX_LEN] = 0;
+  }
+
+  static void poolWriteMap(LabelPool& p) {
+    prefs.putBytes(p.mapKey, &p.map, sizeof(LabelMap));
+    s_nvsBytes += nvsBlobCost(sizeof(LabelMap));
+  }
+
+  static void poolWriteSlot(LabelPool& p, uint8_t id) {
+    char k[8]; labelKey(k, sizeof(k), p.keyPrefix, id);
+    prefs.putString(k, p.text[id]);
+    s_nvsBytes += 2 * NVS_ENTRY;   // string header + one data entry (<= 11 bytes)
+  }
+
+  // A map must describe its own slots: count in range, every listed id in
+  // range and listed once, and exactly the listed ids marked used.
+  static bool mapValid(const LabelMap& m) {
+    if (m.count > MAX_CUSTOM_LABELS) return false;
+    uint16_t seen = 0;
+    for (uint8_t i = 0; i < m.count; ++i) {
+      const uint8_t id = m.order[i];
+      if (id >= MAX_CUSTOM_LABELS || (seen & (1u << id))) return false;
+      seen |= (uint16_t)(1u << id);
     }
+    return seen == m.used;
   }
 
-  // -------- API --------
-  void begin() {
-    prefs.begin(NAMESPACE, false);
+  // A damaged map leaves the pool empty (in RAM only; the next edit rewrites
+  // it) rather than showing stray slots or handing out a live id twice.
+  static void poolLoad(LabelPool& p) {
+    memset(&p.map, 0, sizeof(LabelMap));
+    memset(p.text, 0, sizeof(p.text));
+    if (prefs.getBytesLength(p.mapKey) != sizeof(LabelMap)) return;
+    prefs.getBytes(p.mapKey, &p.map, sizeof(LabelMap));
+    if (!mapValid(p.map)) {
 #ifdef SETTINGS_DEBUG
-    Serial.println(F("[settings_module] begin()"));
-    Serial.print(F("  isKey(ble_ch)=")); Serial.println(prefs.isKey(KEY_BLE_CH));
-    Serial.print(F("  ble u8(short)="));    Serial.println(prefs.getUChar(KEY_BLE_CH, 0));
-    Serial.print(F("  ble u32(legacy)="));  Serial.println(prefs.getUInt(LEGACY_BLE_CH_CAMEL, 0));
-    Serial.print(F("  isKey(din_ch)=")); Serial.println(prefs.isKey(KEY_DIN_CH));
-    Serial.print(F("  din u8(short)="));    Serial.println(prefs.getUChar(KEY_DIN_CH, 0));
-    Serial.print(F("  din u32(legacy)="));  Serial.println(prefs.getUInt(LEGACY_DIN_CH_CAMEL, 0));
+      Serial.print(F("[settings_module] bad label map ")); Serial.print(p.mapKey); Serial.println(F(", pool reset"));
 #endif
+      memset(&p.map, 0, sizeof(LabelMap));
+      return;
+    }
+    for (uint8_t id = 0; id < MAX_CUSTOM_LABELS; ++id) {
+      if (!(p.map.used & (1u << id))) continue;
+      char k[8]; labelKey(k, sizeof(k), p.keyPrefix, id);
+      prefs.getString(k, p.text[id], sizeof(p.text[id]));
+    }
+  }
 
-    // Ensure schema_version exists; if missing, create it
-    if (!prefs.isKey(KEY_SCHEMA_VERSION)) {
-      schemaVersion = CURRENT_SCHEMA_VERSION;
-      writeU8(KEY_SCHEMA_VERSION, (uint8_t)schemaVersion);
-    } else {
-      schemaVersion = readU8(KEY_SCHEMA_VERSION, CURRENT_SCHEMA_VERSION);
+  static const char* poolGet(const LabelPool& p, uint8_t index) {
+    return (index < p.map.count) ? p.text[p.map.order[index]] : "";
+  }
+
+  // 2 writes: the label's slot and the map
+  static bool poolAdd(LabelPool& p, const char* label) {
+    if (p.map.count >= MAX_CUSTOM_LABELS) return false;
+    uint8_t id = 0;
+    while (p.map.used & (1u << id)) ++id;
+    copyLabel(p.text[id], label);
+    p.map.used |= (uint16_t)(1u << id);
+    p.map.order[p.map.count++] = id;
+    poolWriteSlot(p, id);
+    poolWriteMap(p);
+    countWriteThrough(2);
+    return true;
+  }
+
+  // 1 write: the label's slot
+  static void poolUpdate(LabelPool& p, uint8_t index, const char* label) {
+    if (index >= p.map.count) return;
+    const uint8_t id = p.map.order[index];
+    copyLabel(p.text[id], label);
+    poolWriteSlot(p, id);
+    countWriteThrough(1);
+  }
+
+  // Rebuilds the pool as ids 0..n-1: one write per slot whose text changed, plus the map
+  static bool poolReplace(LabelPool& p, const char* const* labels, uint8_t n) {
+    if (n > MAX_CUSTOM_LABELS) return false;
+    LabelMap m = {};
+    for (uint8_t id = 0; id < n; ++id) {
+      char t[LABEL_MAX_LEN + 1]; copyLabel(t, labels[id]);
+      const bool had = p.map.used & (1u << id);
+      if (!had || strcmp(t, p.text[id]) != 0) {
+        memcpy(p.text[id], t, sizeof(t));
+        poolWriteSlot(p, id);
+        countWriteThrough(1);
+      }
+      m.used |= (uint16_t)(1u << id);
+      m.order[m.count++] = id;
+    }
+    for (uint8_t id = n; id < MAX_CUSTOM_LABELS; ++id) p.text[id][0] = 0;
+    if (memcmp(&m, &p.map, sizeof(LabelMap)) != 0) {
+      p.map = m;
+      poolWriteMap(p);
+      countWriteThrough(1);
     }
+    return true;
+  }
 
-    if (schemaVersion != CURRENT_SCHEMA_VERSION) {
-      schemaVersion = CURRENT_SCHEMA_VERSION;
-      writeU8(KEY_SCHEMA_VERSION, (uint8_t)schemaVersion);
+  // 1 write: the map. The slot's old text stays in NVS until the id is reused.
+  static void poolDelete(LabelPool& p, uint8_t index) {
+    if (index >= p.map.count) return;
+    const uint8_t id = p.map.order[index];
+    memmove(&p.map.order[index], &p.map.order[index + 1], p.map.count - index - 1);
+    --p.map.count;
+    p.map.used &= (uint16_t)~(1u << id);
+    p.text[id][0] = 0;
+    poolWriteMap(p);
+    countWriteThrough(1);
+  }
+
+#if SETTINGS_BACKEND_JOURNAL
+  // -------- journal backend --------
+  // Each committed edit is one u64 record in a ring of JOURNAL_SLOTS keys
+  // ("j00".."j31"), so changing one CC costs one 32-byte NVS entry instead
+  // of a whole blob. Record: seq:24 | field:8 | index:8 | value:16 | crc8:8.
+  // Records are only valid with seq in (journalBase, journalBase + SLOTS].
+  // Once the ring is full the RAM state is compacted into the blob snapshot
+  // (journalBase = last seq) and old slots become dead.
+  //
+  // Power loss: NVS writes of one item are atomic, so a cut leaves either the
+  // old or the new record / snapshot. Replay applies records in seq order and
+  // stops at the first gap or bad CRC, so the result is always some prefix of
+  // the edits that were made.
+  static constexpr uint8_t  JOURNAL_SLOTS = 32;
+  static constexpr uint32_t SEQ_MASK      = 0xFFFFFFUL;
+  static uint32_t s_seq = 0;   // last seq written or replayed
+
+  static void slotKey(char* k, uint8_t slot) { k[0] = 'j'; k[1] = '0' + slot / 10; k[2] = '0' + slot % 10; k[3] = 0; }
+
+  static uint8_t crc8(uint64_t v) {
+    uint8_t c = 0;
+    for (int8_t byte = 7; byte >= 1; --byte) {
+      c ^= (uint8_t)(v >> (8 * byte));
+      for (uint8_t k = 0; k < 8; ++k) c = (c & 0x80) ? (uint8_t)((c << 1) ^ 0x07) : (uint8_t)(c << 1);
     }
+    return c;
+  }
+  static uint64_t packRecord(uint32_t seq, Field f, uint8_t i, uint16_t v) {
+    uint64_t r = ((uint64_t)(seq & SEQ_MASK) << 40) | ((uint64_t)(uint8_t)f << 32) |
+                 ((uint64_t)i << 24) | ((uint64_t)v << 8);
+    return r | crc8(r);
+  }
 
-    // Channels (with migration)
-    bleMidiChannel = readChannelMigrating(KEY_BLE_CH, LEGACY_BLE_CH_CAMEL);
-    dinMidiChannel = readChannelMigrating(KEY_DIN_CH, LEGACY_DIN_CH_CAMEL);
-    // Ensure stored under short keys
-    prefs.putUChar(KEY_BLE_CH, bleMidiChannel);
-    prefs.putUChar(KEY_DIN_CH, dinMidiChannel);
+  static void compactJournal() {
+    s_cfg.journalBase = s_seq;
+    writeBlob();
+  }
+
+  static void appendRecord(Field f, uint8_t i) {
+    if (s_seq - s_cfg.journalBase >= JOURNAL_SLOTS) compactJournal();
+    const uint32_t seq = s_seq + 1;
+    char k[4]; slotKey(k, (uint8_t)(seq % JOURNAL_SLOTS));
+    prefs.putULong64(k, packRecord(seq, f, i, fieldValue(s_cfg, f, i)));
+    s_nvsBytes += NVS_ENTRY;
+    s_seq = seq;
+  }
+
+  static void replayJournal() {
+    s_seq = s_cfg.journalBase;
+    uint64_t rec[JOURNAL_SLOTS];
+    for (uint8_t slot = 0; slot < JOURNAL_SLOTS; ++slot) {
+      char k[4]; slotKey(k, slot);
+      rec[slot] = prefs.getULong64(k, 0);
+    }
+    // Walk forward from the snapshot; seq s can only live in slot s % SLOTS.
+    uint16_t applied = 0;
+    for (uint32_t seq = s_cfg.journalBase + 1; seq <= s_cfg.journalBase + JOURNAL_SLOTS; ++seq) {
+      const uint64_t r = rec[seq % JOURNAL_SLOTS];
+      if ((uint8_t)r != crc8(r) || (uint32_t)(r >> 40) != (seq & SEQ_MASK)) break;
+      if (!setFieldValue(s_cfg, (Field)(uint8_t)(r >> 32), (uint8_t)(r >> 24), (uint16_t)(r >> 8))) break;
+      s_seq = seq;
+      ++applied;
+    }
+#ifdef SETTINGS_DEBUG
+    Serial.print(F("[settings_module] journal replayed ")); Serial.print(applied);
+    Serial.print(F(" record(s) after seq ")); Serial.println(s_cfg.journalBase);
+#endif
+  }
+#endif
+
+  // -------- schema migrations --------
+  // Each step upgrades the raw image from `from` to `from + 1` in place and
+  // must be safe to run again (a power cut before the commit re-runs it).
+  // cleanup (optional) runs only after the upgraded blob has been committed.
+  typedef void (*MigrateFn)(uint8_t* raw, size_t& len);
+  typedef void (*CleanupFn)();
+  struct Migration { uint16_t from; MigrateFn run; CleanupFn cleanup; const char* what; };
 
-    // Others
-    presetMode     = readU8(KEY_PRESET_MODE, 0);
-    ledBrightness  = readU8(KEY_LED_BRIGHT, 10);
-    tftBrightness  = readU8(KEY_TFT_BRIGHT, 10);
+  // 0 -> 1: v2.x per-field keys into the blob
+  static void migrateKeysToBlob(uint8_t* raw, size_t& len) {
+    Blob b = DEFAULTS;
+    b.bleMidiChannel = readChannelMigrating(KEY_BLE_CH, LEGACY_BLE_CH_CAMEL);
+    b.dinMidiChannel = readChannelMigrating(KEY_DIN_CH, LEGACY_DIN_CH_CAMEL);
+    b.presetMode     = readU8(KEY_PRESET_MODE, DEFAULTS.presetMode);
+    b.ledBrightness  = readU8(KEY_LED_BRIGHT, DEFAULTS.ledBrightness);
+    b.tftBrightness  = readU8(KEY_TFT_BRIGHT, DEFAULTS.tftBrightness);
     {
       float ms = prefs.getFloat(KEY_MIRROR_DELAY_MS, -1.0f);
-      if (ms < 0.0f) { ms = prefs.getFloat(LEGACY_MIRROR_DELAY_MS, 250.0f); prefs.putFloat(KEY_MIRROR_DELAY_MS, ms); }
-      mirrorDelay = ms / 1000.0f;
+      if (ms < 0.0f) ms = prefs.getFloat(LEGACY_MIRROR_DELAY_MS, (float)DEFAULTS.mirrorDelayMs);
+      b.mirrorDelayMs = (uint16_t)clampT<float>(ms + 0.5f, MIRROR_DELAY_MIN_MS, MIRROR_DELAY_MAX_MS);
     }
 
-    loadIndexedU8Array(KEY_FADER_LBL_IDX, faderLabelIndex, 4, 0);
-    loadIndexedU8Array(KEY_FADER_CC,      faderCC,         4, 20);
-    loadIndexedU8Array(KEY_STOMP_LBL_IDX, stompLabelIndex, 4, 0);
+    loadIndexedU8Array(KEY_FADER_LBL_IDX, b.faderLabelIndex, 4, 0);
+    for (uint8_t i = 0; i < 4; ++i) {   // unsaved slots keep 20..23 (v2.x read 20 for all)
+      String k = String(KEY_FADER_CC) + i;
+      b.faderCC[i] = readU8(k.c_str(), DEFAULTS.faderCC[i]);
+    }
+    loadIndexedU8Array(KEY_STOMP_LBL_IDX, b.stompLabelIndex, 4, 0);
+    loadIndexedU8Array(KEY_STOMP_TYPE,    b.stompType,       4, 0);
 
-    // ---- STOMP CC: seed 80..83 on first run; otherwise honour stored values ----
+    // STOMP CC: honour stored values if any slot was saved, else keep 80..83
     bool haveAnyStomp = false;
     for (uint8_t i = 0; i < 4; ++i) { String k = String(KEY_STOMP_CC) + i; if (prefs.isKey(k.c_str())) { haveAnyStomp = true; break; } }
-    if (haveAnyStomp) {
-      loadIndexedU8Array(KEY_STOMP_CC, stompCC, 4, 80);
-    } else {
-      stompCC[0]=80; stompCC[1]=81; stompCC[2]=82; stompCC[3]=83;
-      saveIndexedU8Array(KEY_STOMP_CC, stompCC, 4);
+    if (haveAnyStomp) loadIndexedU8Array(KEY_STOMP_CC, b.stompCC, 4, 80);
+
+    b.version = 1;
+    memcpy(raw, &b, BLOB_V1_SIZE);
+    len = BLOB_V1_SIZE;
+  }
+
+  // 1 -> 2: append journalBase (no journal yet)
+  static void appendJournalBase(uint8_t* raw, size_t& len) {
+    const uint32_t base = 0;
+    memcpy(raw + BLOB_V1_SIZE, &base, sizeof(base));
+    len = BLOB_V1_SIZE + sizeof(base);
+  }
+
+  static void removeV2Keys() {
+    const char* scalarKeys[] = {
+      KEY_SCHEMA_VERSION, KEY_BLE_CH, KEY_DIN_CH, KEY_PRESET_MODE, KEY_LED_BRIGHT, KEY_TFT_BRIGHT,
+      KEY_MIRROR_DELAY_MS, LEGACY_BLE_CH_CAMEL, LEGACY_DIN_CH_CAMEL, LEGACY_MIRROR_DELAY_MS
+    };
+    for (const char* k : scalarKeys) prefs.remove(k);
+    removeIndexedKeys(KEY_FADER_CC,   4);
+    removeIndexedKeys(KEY_STOMP_CC,   4);
+    removeIndexedKeys(KEY_STOMP_TYPE, 4);
+    // f_lbl_<i> / s_lbl_<i> double as v2.x custom label keys; schema 3 removes them.
+  }
+
+  // 2 -> 3: v2.x custom label strings into the label pools. Writing the new
+  // keys is idempotent; the old keys go in cleanup once the blob says 3.
+  static void importV2Labels(LabelPool& p, const char* countKey, const char* oldPrefix) {
+    uint8_t n = readU8(countKey, 0);
+    if (n > V2_MAX_CUSTOM_LABELS) n = V2_MAX_CUSTOM_LABELS;
+    if (n == 0) return;
+    memset(&p.map, 0, sizeof(LabelMap));
+    for (uint8_t i = 0; i < n; ++i) {
+      char k[16]; labelKey(k, sizeof(k), oldPrefix, i);
+      char buf[32] = {0};
+      prefs.getString(k, buf, sizeof(buf));
+      copyLabel(p.text[i], buf);
+      p.map.used |= (uint16_t)(1u << i);
+      p.map.order[p.map.count++] = i;
+      poolWriteSlot(p, i);
+    }
+    poolWriteMap(p);
+  }
+
+  static void migrateLabelsToPool(uint8_t* /*raw*/, size_t& /*len*/) {
+    importV2Labels(s_faderLabels, KEY_CUSTOM_FADER_COUNT, KEY_FADER_LBL_IDX);
+    importV2Labels(s_stompLabels, KEY_CUSTOM_STOMP_COUNT, KEY_STOMP_LBL_IDX);
+  }
+
+  static void removeV2LabelKeys() {
+    prefs.remove(KEY_CUSTOM_FADER_COUNT);
+    prefs.remove(KEY_CUSTOM_STOMP_COUNT);
+    removeIndexedKeys(KEY_FADER_LBL_IDX, V2_MAX_CUSTOM_LABELS);
+    removeIndexedKeys(KEY_STOMP_LBL_IDX, V2_MAX_CUSTOM_LABELS);
+  }
+
+  // 3 -> 4: append the per-mode overlays. The one set of v3 assignments
+  // becomes the overlay of the mode that was active; values equal to that
+  // mode's profile stay NO_OVERRIDE so untouched modes follow their profile.
+  static void appendModeOverlays(uint8_t* raw, size_t& len) {
+    Blob b = DEFAULTS;
+    memcpy(&b, raw, len < sizeof(Blob) ? len : sizeof(Blob));
+    memcpy(b.modes, DEFAULTS.modes, sizeof(b.modes));
+#if SETTINGS_BACKEND_JOURNAL
+    // Fold pending v3 records first; their CC/label indices are plain slots.
+    s_cfg = b;
+    s_legacyIndices = true;
+    replayJournal();
+    s_legacyIndices = false;
+    b = s_cfg;
+    b.journalBase = s_seq;
+#endif
+    const uint8_t m = modeIndex(b.presetMode);
+    const ModeProfile& p = PROFILES[m];
+    ModeOverlay& o = b.modes[m];
+    for (uint8_t i = 0; i < 4; ++i) {
+      if (b.faderCC[i] != p.faderCC[i]) o.faderCC[i] = b.faderCC[i];
+      if (b.stompCC[i] != p.stompCC[i]) o.stompCC[i] = b.stompCC[i];
+      if (b.faderLabelIndex[i] != DEFAULTS.faderLabelIndex[i]) o.faderLabelIndex[i] = b.faderLabelIndex[i];
+      if (b.stompLabelIndex[i] != DEFAULTS.stompLabelIndex[i]) o.stompLabelIndex[i] = b.stompLabelIndex[i];
+    }
+    b.version = 4;
+    memcpy(raw, &b, sizeof(Blob));
+    len = sizeof(Blob);
+  }
+
+  // 4 -> 5: append fader resolution; every fader keeps sending 7-bit CC.
+  static void appendFaderRes(uint8_t* raw, size_t& len) {
+    Blob b = DEFAULTS;
+    memcpy(&b, raw, len < BLOB_V4_SIZE ? len : BLOB_V4_SIZE);
+    b.version = 5;
+    memcpy(raw, &b, sizeof(Blob));
+    len = sizeof(Blob);
+  }
+
+  // 5 -> 6: append the Axe-FX model; the default (III) is the 512-preset range.
+  static void appendAxeModel(uint8_t* raw, size_t& len) {
+    Blob b = DEFAULTS;
+    memcpy(&b, raw, len < BLOB_V5_SIZE ? len : BLOB_V5_SIZE);
+    b.version = 6;
+    memcpy(raw, &b, sizeof(Blob));
+    len = sizeof(Blob);
+  }
+
+  // Ordered; entry i upgrades schema i to i + 1. Append only.
+  static const Migration MIGRATIONS[] = {
+    { 0, migrateKeysToBlob,  removeV2Keys, "v2 keys -> blob" },
+    { 1, appendJournalBase,  nullptr,      "add journal base" },
+    { 2, migrateLabelsToPool, removeV2LabelKeys, "custom labels -> label pool" },
+    { 3, appendModeOverlays, nullptr,      "per-mode CC/label overlays" },
+    { 4, appendFaderRes,     nullptr,      "fader resolution" },
+    { 5, appendAxeModel,     nullptr,      "axe-fx model" },
+  };
+  static constexpr size_t MIGRATION_COUNT = sizeof(MIGRATIONS) / sizeof(MIGRATIONS[0]);
+  static_assert(MIGRATION_COUNT == CURRENT_SCHEMA_VERSION, "every schema version needs exactly one MIGRATIONS step");
+
+  // Brings whatever is stored up to CURRENT_SCHEMA_VERSION and loads s_cfg.
+  static void loadAndMigrate() {
+    uint8_t raw[MAX_BLOB_BYTES];
+    size_t  len = 0;
+    const uint16_t stored = readStored(raw, len);
+
+    if (stored == CURRENT_SCHEMA_VERSION && len == sizeof(Blob)) {
+      memcpy(&s_cfg, raw, sizeof(Blob));    // normal boot: no writes, no legacy lookups
+      return;
+    }
+    if (stored > CURRENT_SCHEMA_VERSION) {
+      // Written by newer firmware: run on defaults and leave it untouched until
+      // the user changes something.
+      s_cfg = DEFAULTS;
 #ifdef SETTINGS_DEBUG
-      Serial.println(F("[settings_module] seeded STOMP CC defaults 80,81,82,83"));
+      Serial.print(F("[settings_module] blob schema ")); Serial.print(stored);
+      Serial.println(F(" is newer than this firmware, using defaults"));
 #endif
+      return;
     }
 
-    loadIndexedU8Array(KEY_STOMP_TYPE,    stompType,       4, 0);
+    for (uint16_t v = stored; v < CURRENT_SCHEMA_VERSION; ++v) {
+      MIGRATIONS[v].run(raw, len);
+#ifdef SETTINGS_DEBUG
+      Serial.print(F("[settings_module] migrate ")); Serial.print(v);
+      Serial.print(F("->")); Serial.print(v + 1);
+      Serial.print(F(": ")); Serial.println(MIGRATIONS[v].what);
+#endif
+    }
+
+    s_cfg = DEFAULTS;
+    memcpy(&s_cfg, raw, len < sizeof(Blob) ? len : sizeof(Blob));
+    writeBlob();
+    for (uint16_t v = stored; v < CURRENT_SCHEMA_VERSION; ++v) {
+      if (MIGRATIONS[v].cleanup) MIGRATIONS[v].cleanup();
+    }
   }
 
-  // --- ble midi channel ---
-  uint8_t getBleMidiChannel() { return bleMidiChannel; }
-  void setBleMidiChannel(uint8_t ch) {
-    bleMidiChannel = clampT<uint8_t>(ch, 1, 16);
-    prefs.putUChar(KEY_BLE_CH, bleMidiChannel); // short key
+  // -------- staged import --------
+  // An import rewrites the blob (journal: the snapshot) and both label pools,
+  // a dozen NVS writes or more. The whole import is written first as one
+  // entry, which lands or not, and begin() finishes an import that is still
+  // staged, so a power cut part way boots into the old or the new settings.
+  static constexpr const char* KEY_IMPORT  = "cfg_imp";
+  static constexpr uint8_t     KEEP_LABELS = 0xFF;
+  struct StagedImport {
+    Blob    blob;
+    uint8_t faderN, stompN;       // KEEP_LABELS leaves that pool as it is
+    char    fader[MAX_CUSTOM_LABELS][LABEL_MAX_LEN + 1];
+    char    stomp[MAX_CUSTOM_LABELS][LABEL_MAX_LEN + 1];
+  };
+
+  static void stageLabels(char (*dst)[LABEL_MAX_LEN + 1], uint8_t& n, const char* const* labels, uint8_t count) {
+    n = labels ? count : KEEP_LABELS;
+    for (uint8_t i = 0; i < MAX_CUSTOM_LABELS; ++i) copyLabel(dst[i], (labels && i < count) ? labels[i] : "");
+  }
+
+  static void replaceStaged(LabelPool& p, const char (*text)[LABEL_MAX_LEN + 1], uint8_t n) {
+    if (n == KEEP_LABELS) return;
+    const char* l[MAX_CUSTOM_LABELS];
+    for (uint8_t i = 0; i < MAX_CUSTOM_LABELS; ++i) l[i] = text[i];
+    poolReplace(p, l, n);
+  }
+
+  // Safe to repeat: every step writes the staged value, the entry goes last
+  static void applyImport(const StagedImport& st) {
+    Blob b = st.blob;
+    b.journalBase = s_cfg.journalBase;
+    s_cfg = b;
+    selectMode();
+#if SETTINGS_BACKEND_JOURNAL
+    compactJournal();             // the snapshot supersedes every record so far
+#else
+    writeBlob();
+#endif
+    countWriteThrough(1);
+    replaceStaged(s_faderLabels, st.fader, st.faderN);
+    replaceStaged(s_stompLabels, st.stomp, st.stompN);
+    prefs.remove(KEY_IMPORT);
+    ++s_flushes;
+    s_dirty = 0;
+  }
+
+  // An import cut short by a reset; one written by other firmware is dropped
+  static void finishStagedImport() {
+    const size_t len = prefs.getBytesLength(KEY_IMPORT);
+    if (len == 0) return;
+    StagedImport st;
+    const bool ok = len == sizeof(st) &&
+                    prefs.getBytes(KEY_IMPORT, &st, sizeof(st)) == sizeof(st) &&
+                    st.blob.version == CURRENT_SCHEMA_VERSION && st.blob.size == sizeof(Blob);
 #ifdef SETTINGS_DEBUG
-    Serial.print(F("[settings_module] save BLE cache=")); Serial.print(bleMidiChannel);
-    Serial.print(F(" nvs u8(short)=")); Serial.print(prefs.getUChar(KEY_BLE_CH, 0));
-    Serial.print(F(" u32(legacy)="));    Serial.println(prefs.getUInt(LEGACY_BLE_CH_CAMEL, 0));
+    Serial.println(ok ? F("[settings_module] finishing staged import") : F("[settings_module] dropping staged import"));
 #endif
+    if (ok) applyImport(st);
+    else    prefs.remove(KEY_IMPORT);
   }
 
-  // --- din midi channel ---
-  uint8_t getDinMidiChannel() { return dinMidiChannel; }
-  void setDinMidiChannel(uint8_t ch) {
-    dinMidiChannel = clampT<uint8_t>(ch, 1, 16);
-    prefs.putUChar(KEY_DIN_CH, dinMidiChannel); // short key
+  // -------- API --------
+  void begin() {
+    // The cache is authoritative once loaded; reloading would drop pending edits.
+    if (s_begun) return;
+    s_begun = true;
+    prefs.begin(NAMESPACE, false);
+#ifdef SETTINGS_DEBUG
+    Serial.println(F("[settings_module] begin()"));
+#endif
+
+    const uint32_t r0 = prefs.reads, w0 = prefs.writes;
+    loadAndMigrate();
+    poolLoad(s_faderLabels);
+    poolLoad(s_stompLabels);
+#if SETTINGS_BACKEND_JOURNAL
+    replayJournal();
+#endif
+    selectMode();
+    finishStagedImport();
+    s_bootReads  = prefs.reads  - r0;
+    s_bootWrites = prefs.writes - w0;
 #ifdef SETTINGS_DEBUG
-    Serial.print(F("[settings_module] save DIN cache=")); Serial.print(dinMidiChannel);
-    Serial.print(F(" nvs u8(short)=")); Serial.print(prefs.getUChar(KEY_DIN_CH, 0));
-    Serial.print(F(" u32(legacy)="));    Serial.println(prefs.getUInt(LEGACY_DIN_CH_CAMEL, 0));
+    Serial.print(F("[settings_module] boot nvs reads=")); Serial.print(s_bootReads);
+    Serial.print(F(" writes=")); Serial.println(s_bootWrites);
 #endif
   }
 
-  // --- preset mode ---
-  uint8_t getPresetMode() { return presetMode; }
-  void setPresetMode(uint8_t m) {
-    presetMode = m;
-    writeU8(KEY_PRESET_MODE, m);
+  // --- ble midi channel ---
+  uint8_t getBleMidiChannel() { return s_cfg.bleMidiChannel; }
+  void setBleMidiChannel(uint8_t ch) {
+    stage(s_cfg.bleMidiChannel, clampT<uint8_t>(ch, 1, 16), Field::BleChannel);
   }
 
-  uint8_t getLedBrightness() { return ledBrightness; }
-  void setLedBrightness(uint8_t l) {
-    ledBrightness = l;
-    writeU8(KEY_LED_BRIGHT, l);
+  // --- din midi channel ---
+  uint8_t getDinMidiChannel() { return s_cfg.dinMidiChannel; }
+  void setDinMidiChannel(uint8_t ch) {
+    stage(s_cfg.dinMidiChannel, clampT<uint8_t>(ch, 1, 16), Field::DinChannel);
   }
 
-  uint8_t getTftBrightness() { return tftBrightness; }
-  void setTftBrightness(uint8_t l) {
-    tftBrightness = l;
-    writeU8(KEY_TFT_BRIGHT, l);
+  // --- preset mode ---
+  uint8_t getPresetMode() { return s_cfg.presetMode; }
+  void setPresetMode(uint8_t m) {
+    if (m >= PRESET_MODE_COUNT || m == s_cfg.presetMode) { ++s_setterCalls; return; }
+#if SETTINGS_BACKEND_JOURNAL
+    // Pending CC/label records are indexed by the mode they were made in
+    if (s_dirty) flushNow();
+#endif
+    // Subscribers hear about the mode only once the getters read its overlay
+    ++s_quiet;
+    stage(s_cfg.presetMode, m, Field::PresetMode);
+    --s_quiet;
+    selectMode();
+    notify(Field::PresetMode, 0);
+    // Every CC/label getter now reads another overlay
+    notify(Field::FaderCC, ALL_SLOTS);
+    notify(Field::StompCC, ALL_SLOTS);
+    notify(Field::FaderLabelIndex, ALL_SLOTS);
+    notify(Field::StompLabelIndex, ALL_SLOTS);
   }
+  const char* presetModeName(uint8_t m) { return (m < PRESET_MODE_COUNT) ? PROFILES[m].name : ""; }
 
-  float getMirrorDelay() { return mirrorDelay; }
+  uint8_t getLedBrightness() { return s_cfg.ledBrightness; }
+  void setLedBrightness(uint8_t l) { stage(s_cfg.ledBrightness, l, Field::LedBrightness); }
+
+  uint8_t getTftBrightness() { return s_cfg.tftBrightness; }
+  void setTftBrightness(uint8_t l) { stage(s_cfg.tftBrightness, l, Field::TftBrightness); }
+
+  float getMirrorDelay() { return s_cfg.mirrorDelayMs / 1000.0f; }
   void  setMirrorDelay(float s) {
-    mirrorDelay = (s < 0.0f) ? 0.0f : s;
-    prefs.putFloat(KEY_MIRROR_DELAY_MS, mirrorDelay * 1000.0f);
+    const float ms = clampT<float>(s * 1000.0f + 0.5f, MIRROR_DELAY_MIN_MS, MIRROR_DELAY_MAX_MS);
+    stage(s_cfg.mirrorDelayMs, (uint16_t)ms, Field::MirrorDelay);
   }
 
-  // --- label index getters/setters ---
-  uint8_t getFaderLabelIndex(uint8_t i) { return (i < 4) ? faderLabelIndex[i] : 0; }
+  // --- label index getters/setters (current mode's overlay) ---
+  uint8_t getFaderLabelIndex(uint8_t i) {
+    return (i < 4) ? resolve(s_overlay->faderLabelIndex[i], DEFAULTS.faderLabelIndex[i]) : 0;
+  }
   void setFaderLabelIndex(uint8_t i, uint8_t idx) {
-    if (i < 4) { faderLabelIndex[i] = idx; String k = String(KEY_FADER_LBL_IDX) + i; writeU8(k.c_str(), idx); }
+    if (i < 4 && idx != NO_OVERRIDE) stage(s_overlay->faderLabelIndex[i], idx, Field::FaderLabelIndex, i);
+  }
+  uint8_t getStompLabelIndex(uint8_t i) {
+    return (i < 4) ? resolve(s_overlay->stompLabelIndex[i], DEFAULTS.stompLabelIndex[i]) : 0;
   }
-  uint8_t getStompLabelIndex(uint8_t i) { return (i < 4) ? stompLabelIndex[i] : 0; }
   void setStompLabelIndex(uint8_t i, uint8_t idx) {
-    if (i < 4) { stompLabelIndex[i] = idx; String k = String(KEY_STOMP_LBL_IDX) + i; writeU8(k.c_str(), idx); }
+    if (i < 4 && idx != NO_OVERRIDE) stage(s_overlay->stompLabelIndex[i], idx, Field::StompLabelIndex, i);
+  }
+  // Profile labels only show until the user picks a label for that control
+  const char* getFaderProfileLabel(uint8_t i) {
+    return (i < 4 && s_overlay->faderLabelIndex[i] == NO_OVERRIDE) ? s_profile->faderLabel[i] : nullptr;
+  }
+  const char* getStompProfileLabel(uint8_t i) {
+    return (i < 4 && s_overlay->stompLabelIndex[i] == NO_OVERRIDE) ? s_profile->stompLabel[i] : nullptr;
   }
 
-  // --- cc getters/setters ---
-  uint8_t getFaderCC(uint8_t i) { return (i < 4) ? faderCC[i] : 0; }
+  // --- cc getters/setters (current mode's overlay) ---
+  uint8_t getFaderCC(uint8_t i) { return (i < 4) ? resolve(s_overlay->faderCC[i], s_profile->faderCC[i]) : 0; }
   void setFaderCC(uint8_t i, uint8_t cc) {
-    if (i < 4) { faderCC[i] = cc; String k = String(KEY_FADER_CC) + i; writeU8(k.c_str(), cc); }
+    if (i < 4) stage(s_overlay->faderCC[i], clampT<uint8_t>(cc, 0, 127), Field::FaderCC, i);
   }
-  uint8_t getStompCC(uint8_t i) { return (i < 4) ? stompCC[i] : 0; }
+  uint8_t getStompCC(uint8_t i) { return (i < 4) ? resolve(s_overlay->stompCC[i], s_profile->stompCC[i]) : 0; }
   void setStompCC(uint8_t i, uint8_t cc) {
-    if (i < 4) { stompCC[i] = cc; String k = String(KEY_STOMP_CC) + i; writeU8(k.c_str(), cc); }
+    if (i < 4) stage(s_overlay->stompCC[i], clampT<uint8_t>(cc, 0, 127), Field::StompCC, i);
+  }
+
+  // --- fader resolution ---
+  uint8_t getFaderRes(uint8_t i) { return (i < 4) ? s_cfg.faderRes[i] : (uint8_t)FADER_RES_7BIT; }
+  void setFaderRes(uint8_t i, uint8_t res) {
+    if (i < 4 && res <= FADER_RES_NRPN) stage(s_cfg.faderRes[i], res, Field::FaderRes, i);
+  }
+  uint8_t getFaderNrpnMsb(uint8_t i) { return (i < 4) ? s_cfg.faderNrpnMsb[i] : 0; }
+  void setFaderNrpnMsb(uint8_t i, uint8_t msb) {
+    if (i < 4) stage(s_cfg.faderNrpnMsb[i], clampT<uint8_t>(msb, 0, 127), Field::FaderNrpnMsb, i);
+  }
+
+  // --- Axe-FX model ---
+  uint8_t getAxeModel() { return s_cfg.axeModel; }
+  void setAxeModel(uint8_t m) {
+    if (m <= AXE_FX_III) stage(s_cfg.axeModel, m, Field::AxeModel);
   }
 
   // --- stomp type getters/setters ---
-  uint8_t getStompType(uint8_t i) { return (i < 4) ? stompType[i] : 0; }
+  uint8_t getStompType(uint8_t i) { return (i < 4) ? s_cfg.stompType[i] : 0; }
   void setStompType(uint8_t i, uint8_t t) {
-    if (i < 4) { stompType[i] = t; String k = String(KEY_STOMP_TYPE) + i; writeU8(k.c_str(), t); }
+    if (i < 4) stage(s_cfg.stompType[i], t, Field::StompType, i);
   }
 
   // --- custom fader labels ---
-  uint8_t getCustomFaderLabelCount() { return customFaderLabelCount; }
-  String  getCustomFaderLabel(uint8_t i) { return (i < customFaderLabelCount) ? customFaderLabels[i] : String(""); }
-  void addCustomFaderLabel(const String& l) {
-    if (customFaderLabelCount < 8) {
-      customFaderLabels[customFaderLabelCount] = l;
-      String k = String("f_lbl_") + customFaderLabelCount;
-      prefs.putString(k.c_str(), l);
-      ++customFaderLabelCount;
-      writeU8(KEY_CUSTOM_FADER_COUNT, customFaderLabelCount);
-    }
-  }
-  void updateCustomFaderLabel(uint8_t i, const String& l) {
-    if (i < customFaderLabelCount) {
-      String k = String("f_lbl_") + i;
-      prefs.putString(k.c_str(), l);
-      customFaderLabels[i] = l;
-    }
-  }
-  void deleteCustomFaderLabel(uint8_t i) {
-    if (i < customFaderLabelCount) {
-      for (uint8_t j = i; j + 1 < customFaderLabelCount; ++j) {
-        customFaderLabels[j] = customFaderLabels[j + 1];
-        String k = String("f_lbl_") + j;
-        prefs.putString(k.c_str(), customFaderLabels[j]);
+  uint8_t     getCustomFaderLabelCount()                     { return s_faderLabels.map.count; }
+  const char* getCustomFaderLabel(uint8_t i)                 { return poolGet(s_faderLabels, i); }
+  bool        addCustomFaderLabel(const char* l)             { return poolAdd(s_faderLabels, l); }
+  void        updateCustomFaderLabel(uint8_t i, const char* l) { poolUpdate(s_faderLabels, i, l); }
+  void        deleteCustomFaderLabel(uint8_t i)              { poolDelete(s_faderLabels, i); }
+
+  // --- custom stomp labels ---
+  uint8_t     getCustomStompLabelCount()                     { return s_stompLabels.map.count; }
+  const char* getCustomStompLabel(uint8_t i)                 { return poolGet(s_stompLabels, i); }
+  bool        addCustomStompLabel(const char* l)             { return poolAdd(s_stompLabels, l); }
+  void        updateCustomStompLabel(uint8_t i, const char* l) { poolUpdate(s_stompLabels, i, l); }
+  void        deleteCustomStompLabel(uint8_t i)              { poolDelete(s_stompLabels, i); }
+
+  // --- commit layer ---
+  void update() {
+    if (s_dirty && (millis() - s_lastChange) >= SETTINGS_FLUSH_IDLE_MS) flushNow();
+  }
+
+  void flushNow() {
+    if (!s_dirty) return;
+#if SETTINGS_BACKEND_JOURNAL
+    // One record per dirty slot, unless a snapshot is cheaper anyway
+    uint8_t n = 0;
+    for (uint64_t m = s_dirty; m; m &= m - 1) ++n;
+    if ((uint32_t)n * NVS_ENTRY >= nvsBlobCost(sizeof(Blob))) {
+      compactJournal();      // snapshot covers everything up to the current seq
+      ++s_nvsWrites;
+    } else {
+      for (uint8_t f = 0; f < (uint8_t)Field::Count; ++f) {
+        for (uint8_t i = 0; i < slotsOf((Field)f); ++i) {
+          if (s_dirty & bitFor((Field)f, i)) { appendRecord((Field)f, recordIndex((Field)f, i)); ++s_nvsWrites; }
+        }
       }
-      --customFaderLabelCount;
-      writeU8(KEY_CUSTOM_FADER_COUNT, customFaderLabelCount);
-      String remKey = String("f_lbl_") + customFaderLabelCount;
-      prefs.remove(remKey.c_str());
     }
+#else
+    writeBlob();   // every dirty field lands in one putBytes
+    ++s_nvsWrites;
+#endif
+    s_dirty = 0;
+    ++s_flushes;
+#ifdef SETTINGS_DEBUG
+    Serial.print(F("[settings_module] flush, saved ")); Serial.println(writesSaved());
+#endif
   }
 
-  // --- custom stomp labels ---
-  uint8_t getCustomStompLabelCount() { return customStompLabelCount; }
-  String  getCustomStompLabel(uint8_t i) { return (i < customStompLabelCount) ? customStompLabels[i] : String(""); }
-  void addCustomStompLabel(const String& l) {
-    if (customStompLabelCount < 8) {
-      customStompLabels[customStompLabelCount] = l;
-      String k = String("s_lbl_") + customStompLabelCount;
-      prefs.putString(k.c_str(), l);
-      ++customStompLabelCount;
-      writeU8(KEY_CUSTOM_STOMP_COUNT, customStompLabelCount);
-    }
-  }
-  void updateCustomStompLabel(uint8_t i, const String& l) {
-    if (i < customStompLabelCount) {
-      String k = String("s_lbl_") + i;
-      prefs.putString(k.c_str(), l);
-      customStompLabels[i] = l;
-    }
-  }
-  void deleteCustomStompLabel(uint8_t i) {
-    if (i < customStompLabelCount) {
-      for (uint8_t j = i; j + 1 < customStompLabelCount; ++j) {
-        customStompLabels[j] = customStompLabels[j + 1];
-        String k = String("s_lbl_") + j;
-        prefs.putString(k.c_str(), customStompLabels[j]);
+  bool     dirty()       { return s_dirty != 0; }
+  uint32_t bootNvsReads()  { return s_bootReads; }
+  uint32_t bootNvsWrites() { return s_bootWrites; }
+  uint32_t nvsWrites()   { return s_nvsWrites; }
+  uint32_t nvsBytesWritten() { return s_nvsBytes; }
+  uint32_t writesSaved() { return s_setterCalls > s_nvsWrites ? s_setterCalls - s_nvsWrites : 0; }
+
+  // --- bulk transfer ---
+  uint16_t schemaVersion() { return CURRENT_SCHEMA_VERSION; }
+
+  size_t exportImage(uint8_t* buf, size_t cap) {
+    if (cap < sizeof(Blob)) return 0;
+    Blob b = s_cfg;               // pending edits included
+    b.version     = CURRENT_SCHEMA_VERSION;
+    b.size        = sizeof(Blob);
+    b.journalBase = 0;            // device-local
+    b.crc         = payloadCrc((const uint8_t*)&b, sizeof(Blob));
+    memcpy(buf, &b, sizeof(Blob));
+    return sizeof(Blob);
+  }
+
+  static bool validCC(uint8_t v)    { return v <= 127 || v == NO_OVERRIDE; }
+  // Built-in labels come first in the global list, the custom pool after them
+  static bool validLabel(uint8_t v, uint8_t builtIn, uint8_t poolSize) { return v == NO_OVERRIDE || v < builtIn + poolSize; }
+  static bool imageInRange(const Blob& b, uint8_t faderLabels, uint8_t stompLabels) {
+    if (b.bleMidiChannel < 1 || b.bleMidiChannel > 16) return false;
+    if (b.dinMidiChannel < 1 || b.dinMidiChannel > 16) return false;
+    if (b.presetMode >= PRESET_MODE_COUNT) return false;
+    if (b.ledBrightness > 20 || b.tftBrightness < 1 || b.tftBrightness > 20) return false;
+    if (b.axeModel > AXE_FX_III) return false;
+    if (b.mirrorDelayMs < MIRROR_DELAY_MIN_MS || b.mirrorDelayMs > MIRROR_DELAY_MAX_MS) return false;
+    for (uint8_t i = 0; i < 4; ++i) {
+      if (b.stompType[i] > 1) return false;
+      if (b.faderRes[i] > FADER_RES_NRPN || b.faderNrpnMsb[i] > 127) return false;
+      for (const ModeOverlay& o : b.modes) {
+        if (!validCC(o.faderCC[i]) || !validCC(o.stompCC[i])) return false;
+        if (!validLabel(o.faderLabelIndex[i], BUILTIN_FADER_LABELS, faderLabels)) return false;
+        if (!validLabel(o.stompLabelIndex[i], BUILTIN_STOMP_LABELS, stompLabels)) return false;
       }
-      --customStompLabelCount;
-      writeU8(KEY_CUSTOM_STOMP_COUNT, customStompLabelCount);
-      String remKey = String("s_lbl_") + customStompLabelCount;
-      prefs.remove(remKey.c_str());
     }
+    return true;
   }
 
-  bool applyPresetDefaults(uint8_t /*mode*/) { return false; }
-  bool setPresetModeAndApply(uint8_t mode) { bool applied = applyPresetDefaults(mode); setPresetMode(mode); return applied; }
+  bool importImage(const uint8_t* raw, size_t len,
+                   const char* const* faderLabels, uint8_t faderCount,
+                   const char* const* stompLabels, uint8_t stompCount) {
+    if (len != sizeof(Blob)) return false;
+    if ((faderLabels && faderCount > MAX_CUSTOM_LABELS) || (stompLabels && stompCount > MAX_CUSTOM_LABELS)) return false;
+    StagedImport st;
+    memcpy(&st.blob, raw, sizeof(Blob));
+    const Blob& b = st.blob;
+    if (b.version != CURRENT_SCHEMA_VERSION || b.size != sizeof(Blob)) return false;
+    const uint8_t nf = faderLabels ? faderCount : s_faderLabels.map.count;
+    const uint8_t ns = stompLabels ? stompCount : s_stompLabels.map.count;
+    if (b.crc != payloadCrc(raw, len) || !imageInRange(b, nf, ns)) return false;
+
+    stageLabels(st.fader, st.faderN, faderLabels, faderCount);
+    stageLabels(st.stomp, st.stompN, stompLabels, stompCount);
+    prefs.putBytes(KEY_IMPORT, &st, sizeof(st));
+    s_nvsBytes += nvsBlobCost(sizeof(st));
+    countWriteThrough(1);
+    applyImport(st);
+    for (uint8_t f = 0; f < (uint8_t)Field::Count; ++f) {
+      notify((Field)f, slotsOf((Field)f) > 1 ? ALL_SLOTS : 0);
+    }
+    return true;
+  }
+
+  bool replaceCustomFaderLabels(const char* const* l, uint8_t n) { return poolReplace(s_faderLabels, l, n); }
+  bool replaceCustomStompLabels(const char* const* l, uint8_t n) { return poolReplace(s_stompLabels, l, n); }
+
+  bool subscribe(uint16_t fieldMask, ChangeFn fn) {
+    if (!fn || s_subCount >= MAX_SUBSCRIBERS) return false;
+    s_subs[s_subCount++] = { fieldMask, fn };
+    return true;
+  }
+  uint16_t generation(Field f) { return ((uint8_t)f < (uint8_t)Field::Count) ? s_gen[(uint8_t)f] : 0; }
+
+  // Drops the user's edits for `mode` so its profile shows through again.
+  bool applyPresetDefaults(uint8_t mode) {
+    if (mode >= PRESET_MODE_COUNT) return false;
+    const uint8_t saved = s_cfg.presetMode;
+    // Overlay edits are staged against the active mode. Consumers only see a
+    // change when `mode` is the active one (then no switch happens at all).
+    const bool other = (mode != saved);
+    if (other) { ++s_quiet; setPresetMode(mode); }
+    for (uint8_t i = 0; i < 4; ++i) {
+      stage(s_overlay->faderCC[i],         NO_OVERRIDE, Field::FaderCC, i);
+      stage(s_overlay->stompCC[i],         NO_OVERRIDE, Field::StompCC, i);
+      stage(s_overlay->faderLabelIndex[i], NO_OVERRIDE, Field::FaderLabelIndex, i);
+      stage(s_overlay->stompLabelIndex[i], NO_OVERRIDE, Field::StompLabelIndex, i);
+    }
+    if (other) { setPresetMode(saved); --s_quiet; }
+    return true;
+  }
+
+  // Profiles apply on first entry simply because an untouched overlay falls
+  // through to them; re-selecting a mode keeps its edits. False if `mode`
+  // is invalid or already active.
+  bool setPresetModeAndApply(uint8_t mode) {
+    if (mode >= PRESET_MODE_COUNT || mode == s_cfg.presetMode) return false;
+    setPresetMode(mode);
+    return true;
+  }
 
   void dumpToSerial(Stream& out) {
     out.println(F("[settings_module] dump:"));
-    out.print(F(" schema_version: ")); out.println(readU8(KEY_SCHEMA_VERSION, CURRENT_SCHEMA_VERSION));
-    out.print(F(" bleMidiChannel: ")); out.println(bleMidiChannel);
-    out.print(F(" dinMidiChannel: ")); out.println(dinMidiChannel);
-    out.print(F(" presetMode:     ")); out.println(presetMode);
-    out.print(F(" ledBrightness:  ")); out.println(ledBrightness);
-    out.print(F(" tftBrightness:  ")); out.println(tftBrightness);
-    out.print(F(" mirrorDelay:    ")); out.println(mirrorDelay, 3);
+    out.print(F(" blob version:   ")); out.print(s_cfg.version);
+    out.print(F(" crc=0x")); out.print(s_cfg.crc, HEX);
+    out.print(F(" boot nvs r/w=")); out.print(s_bootReads); out.print('/'); out.println(s_bootWrites);
+    out.print(F(" s_cfg.bleMidiChannel: ")); out.println(s_cfg.bleMidiChannel);
+    out.print(F(" s_cfg.dinMidiChannel: ")); out.println(s_cfg.dinMidiChannel);
+    out.print(F(" s_cfg.presetMode:     ")); out.print(s_cfg.presetMode);
+    out.print(' '); out.println(presetModeName(s_cfg.presetMode));
+    out.print(F(" s_cfg.axeModel:       ")); out.println(s_cfg.axeModel == AXE_FX_II ? F("Axe-FX II") : F("Axe-FX III/FM"));
+    out.print(F(" s_cfg.ledBrightness:  ")); out.println(s_cfg.ledBrightness);
+    out.print(F(" s_cfg.tftBrightness:  ")); out.println(s_cfg.tftBrightness);
+    out.print(F(" mirrorDelay:    ")); out.println(getMirrorDelay(), 3);
+    out.print(F(" commit: dirty=0x")); out.print((unsigned long long)s_dirty, HEX);
+    out.print(F(" flushes=")); out.print(s_flushes);
+    out.print(F(" writes=")); out.print(s_nvsWrites);
+    out.print(F(" bytes=")); out.print(s_nvsBytes);
+    out.print(F(" saved=")); out.println(writesSaved());
+    out.print(F(" subscribers=")); out.print(s_subCount); out.print(F(" gen:"));
+    for (uint8_t f = 0; f < (uint8_t)Field::Count; ++f) { out.print(' '); out.print(s_gen[f]); }
+    out.println();
 
     for (uint8_t i = 0; i < 4; ++i) {
-      out.print(F(" fader[")); out.print(i); out.print(F("] lblIdx=")); out.print(faderLabelIndex[i]);
-      out.print(F(" cc=")); out.print(faderCC[i]);
-      out.print(F(" | stomp[")); out.print(i); out.print(F("] lblIdx=")); out.print(stompLabelIndex[i]);
-      out.print(F(" cc=")); out.print(stompCC[i]);
-      out.print(F(" type=")); out.println(stompType[i]);
+      out.print(F(" fader[")); out.print(i); out.print(F("] lblIdx=")); out.print(getFaderLabelIndex(i));
+      out.print(F(" cc=")); out.print(getFaderCC(i)); out.print(s_overlay->faderCC[i] == NO_OVERRIDE ? ' ' : '*');
+      out.print(F(" | stomp[")); out.print(i); out.print(F("] lblIdx=")); out.print(getStompLabelIndex(i));
+      out.print(F(" cc=")); out.print(getStompCC(i)); out.print(s_overlay->stompCC[i] == NO_OVERRIDE ? ' ' : '*');
+      out.print(F(" type=")); out.println(s_cfg.stompType[i]);
+    }
+    for (uint8_t i = 0; i < 4; ++i) {
+      static const char* const RES[] = { "7-bit", "14-bit cc", "nrpn" };
+      out.print(F(" fader[")); out.print(i); out.print(F("] res=")); out.print(RES[s_cfg.faderRes[i] <= FADER_RES_NRPN ? s_cfg.faderRes[i] : 0]);
+      if (s_cfg.faderRes[i] == FADER_RES_NRPN) {
+        out.print(F(" param=")); out.print(s_cfg.faderNrpnMsb[i]); out.print('/'); out.print(getFaderCC(i));
+      }
+      out.println();
     }
 
-    out.print(F(" customFaderLabels(")); out.print(customFaderLabelCount); out.println(F(")"));
-    for (uint8_t i = 0; i < customFaderLabelCount; ++i) {
-      out.print(F("  [")); out.print(i); out.print(F("] ")); out.println(customFaderLabels[i]);
+    out.print(F(" customFaderLabels(")); out.print(getCustomFaderLabelCount()); out.println(F(")"));
+    for (uint8_t i = 0; i < getCustomFaderLabelCount(); ++i) {
+      out.print(F("  [")); out.print(i); out.print(F("] ")); out.println(getCustomFaderLabel(i));
     }
 
-    out.print(F(" customStompLabels(")); out.print(customStompLabelCount); out.println(F(")"));
-    for (uint8_t i = 0; i < customStompLabelCount; ++i) {
-      out.print(F("  [")); out.print(i); out.print(F("] ")); out.println(customStompLabels[i]);
+    out.print(F(" customStompLabels(")); out.print(getCustomStompLabelCount()); out.println(F(")"));
+    for (uint8_t i = 0; i < getCustomStompLabelCount(); ++i) {
+      out.print(F("  [")); out.print(i); out.print(F("] ")); out.println(getCustomStompLabel(i));
     }
   }
 }
@@ -5,9 +5,44 @@
 #include <Preferences.h>
 
 namespace settings_module {
-  // Initialize storage and load cached values. Safe to call once at boot.
+  // Initialize storage and load cached values. Later calls are no-ops.
   void begin();
 
+  // The RAM cache is the source of truth: setters only mark fields dirty and
+  // update() commits them in one batch once nothing has changed for a while.
+  enum class Field : uint8_t {
+    BleChannel, DinChannel, PresetMode, LedBrightness, TftBrightness, MirrorDelay,
+    FaderLabelIndex, FaderCC, StompLabelIndex, StompCC, StompType,   // 4 slots each
+    FaderRes, FaderNrpnMsb,                                          // 4 slots each
+    AxeModel,                                                        // scalar
+    Count
+  };
+  void     update();        // idle flush
+  void     flushNow();      // commit all dirty fields immediately
+  bool     dirty();
+  uint32_t nvsWrites();     // NVS writes done by flushes so far
+  uint32_t nvsBytesWritten(); // flash bytes those writes cost (32-byte NVS entries)
+  uint32_t writesSaved();   // setter calls that did not cost an NVS write
+  // NVS ops spent in begin(). A normal boot writes nothing and reads the blob
+  // (2), each label pool (1 without a map, else 2 + one per label), the
+  // staged import's length (1) and, with the journal backend, its 32 record
+  // slots.
+  uint32_t bootNvsReads();
+  uint32_t bootNvsWrites();
+
+  // --- change notification ---
+  // Subscribers run synchronously inside the setter that changed a value (not
+  // on flush), from the main loop only. index is the slot of a 4-slot field,
+  // or ALL_SLOTS when a preset mode switch changed every slot at once.
+  // generation() bumps on every change, so consumers that cache lookups can
+  // compare it instead of subscribing.
+  typedef void (*ChangeFn)(Field field, uint8_t index);
+  static const uint8_t MAX_SUBSCRIBERS = 8;
+  static const uint8_t ALL_SLOTS       = 0xFF;
+  constexpr uint16_t maskOf(Field f) { return (uint16_t)(1u << (uint8_t)f); }
+  bool     subscribe(uint16_t fieldMask, ChangeFn fn);   // false when the table is full
+  uint16_t generation(Field field);
+
   // --- Existing getters/setters (unchanged signatures) ---
   uint8_t getBleMidiChannel();
   void    setBleMidiChannel(uint8_t channel);
@@ -15,8 +50,18 @@ namespace settings_module {
   uint8_t getDinMidiChannel();
   void    setDinMidiChannel(uint8_t channel);
 
-  uint8_t getPresetMode();
-  void    setPresetMode(uint8_t mode);
+  // Preset modes follow preset_mode_list (0-127, 1-128, Helix, Kemper, ...).
+  // Each has factory CCs/labels in flash; the CC and label getters/setters
+  // below act on the current mode's own copy. Out-of-range modes are ignored.
+  static const uint8_t PRESET_MODE_COUNT = 10;
+  uint8_t     getPresetMode();
+  void        setPresetMode(uint8_t mode);
+  const char* presetModeName(uint8_t mode);
+
+  // Axe-FX mode preset range: II = 384 presets, III / FM3 / FM9 = 512
+  enum AxeModel : uint8_t { AXE_FX_II = 0, AXE_FX_III = 1 };
+  uint8_t getAxeModel();
+  void    setAxeModel(uint8_t model);
 
   uint8_t getLedBrightness();
   void    setLedBrightness(uint8_t level);
@@ -25,7 +70,13 @@ namespace settings_module {
   void    setTftBrightness(uint8_t level);
 
   float   getMirrorDelay();
-  void    setMirrorDelay(float delay);
+  void    setMirrorDelay(float delay);   // seconds, clamped to 0.1 .. 3.0
+
+  // Label indices point into the global label lists: the built-in labels
+  // first (fader_labels_list / stomp_labels_list), then the custom pool, so
+  // custom label n is BUILTIN_*_LABELS + n.
+  static const uint8_t BUILTIN_FADER_LABELS = 20;
+  static const uint8_t BUILTIN_STOMP_LABELS = 18;
 
   // Built‑in Fader labels (index into your global fader labels list)
   uint8_t getFaderLabelIndex(uint8_t fader);
@@ -35,10 +86,25 @@ namespace settings_module {
   uint8_t getStompLabelIndex(uint8_t stomp);
   void    setStompLabelIndex(uint8_t stomp, uint8_t labelIndex);
 
+  // Factory label of the current mode (Kemper, Axe-FX), or nullptr when the
+  // mode has none or the user has chosen a label for that control
+  const char* getFaderProfileLabel(uint8_t fader);
+  const char* getStompProfileLabel(uint8_t stomp);
+
   // Fader CC assignments
   uint8_t getFaderCC(uint8_t fader);
   void    setFaderCC(uint8_t fader, uint8_t cc);
 
+  // Fader resolution. 14-bit CC sends the MSB on the fader's CC and the LSB
+  // on CC + 32 (only for CC 0..31; higher CCs fall back to 7-bit). NRPN
+  // selects parameter (getFaderNrpnMsb, fader CC) via CC 99/98 and sends the
+  // value with data entry CC 6/38. Per fader, not per preset mode.
+  enum FaderRes : uint8_t { FADER_RES_7BIT = 0, FADER_RES_14BIT_CC = 1, FADER_RES_NRPN = 2 };
+  uint8_t getFaderRes(uint8_t fader);
+  void    setFaderRes(uint8_t fader, uint8_t res);
+  uint8_t getFaderNrpnMsb(uint8_t fader);             // 0..127
+  void    setFaderNrpnMsb(uint8_t fader, uint8_t msb);
+
   // Stomp CC assignments
   uint8_t getStompCC(uint8_t stomp);
   void    setStompCC(uint8_t stomp, uint8_t cc);
@@ -48,24 +114,46 @@ namespace settings_module {
   void    setStompType(uint8_t stomp, uint8_t type);
 
   // --- Custom label management ---
+  // Fixed pools, no heap: labels are truncated to LABEL_MAX_LEN characters.
+  // Getters return a view into the pool ("" if out of range) that stays valid
+  // until that label is updated or deleted. add returns false when full.
   static const uint8_t MAX_CUSTOM_LABELS = 16;
+  static const uint8_t LABEL_MAX_LEN     = 10;
 
   // Fader custom labels
-  uint8_t getCustomFaderLabelCount();
-  String  getCustomFaderLabel(uint8_t index);
-  void    addCustomFaderLabel(const String& label);
-  void    updateCustomFaderLabel(uint8_t index, const String& label);
-  void    deleteCustomFaderLabel(uint8_t index);
+  uint8_t     getCustomFaderLabelCount();
+  const char* getCustomFaderLabel(uint8_t index);
+  bool        addCustomFaderLabel(const char* label);
+  void        updateCustomFaderLabel(uint8_t index, const char* label);
+  void        deleteCustomFaderLabel(uint8_t index);
 
   // Stomp custom labels
-  uint8_t getCustomStompLabelCount();
-  String  getCustomStompLabel(uint8_t index);
-  void    addCustomStompLabel(const String& label);
-  void    updateCustomStompLabel(uint8_t index, const String& label);
-  void    deleteCustomStompLabel(uint8_t index);
+  uint8_t     getCustomStompLabelCount();
+  const char* getCustomStompLabel(uint8_t index);
+  bool        addCustomStompLabel(const char* label);
+  void        updateCustomStompLabel(uint8_t index, const char* label);
+  void        deleteCustomStompLabel(uint8_t index);
+
+  // --- Bulk transfer (see settings_transfer) ---
+  // The image is the settings blob exactly as stored: header, CRC, payload.
+  // importImage only accepts the current schema; it range-checks every field,
+  // replaces all settings and the custom label lists that are given (nullptr
+  // keeps a list) and notifies every field. Label indices are checked against
+  // the built-in labels plus the custom counts that apply after the import.
+  // Everything is staged as one NVS entry before it is applied, so a power
+  // cut part way leaves the old settings or (finished at boot) the new ones.
+  static const uint16_t IMAGE_MAX_BYTES = 256;
+  uint16_t schemaVersion();
+  size_t   exportImage(uint8_t* buf, size_t cap);   // bytes written, 0 if cap is too small
+  bool     importImage(const uint8_t* raw, size_t len,
+                       const char* const* faderLabels, uint8_t faderCount,
+                       const char* const* stompLabels, uint8_t stompCount);
+  // Replace a whole custom label list; only slots whose text changed are written.
+  bool     replaceCustomFaderLabels(const char* const* labels, uint8_t count);
+  bool     replaceCustomStompLabels(const char* const* labels, uint8_t count);
 
   // --- New optional helpers (non‑breaking) ---
-  bool    applyPresetDefaults(uint8_t mode);
-  bool    setPresetModeAndApply(uint8_t mode);
+  bool    applyPresetDefaults(uint8_t mode);    // forget the user's CC/label edits for mode
+  bool    setPresetModeAndApply(uint8_t mode);  // switch; edits of each mode are kept
   void    dumpToSerial(Stream& out = Serial);
 }
\ No newline at end of file
@@ -0,0 +1,162 @@
+// =============================
+// File: src/settings_transfer.cpp
+// =============================
+#include "settings_transfer.h"
+#include <string.h>
+#include <stdlib.h>
+#include "settings_module.h"
+
+using settings_module::IMAGE_MAX_BYTES;
+using settings_module::LABEL_MAX_LEN;
+using settings_module::MAX_CUSTOM_LABELS;
+
+namespace {
+  static constexpr uint8_t BYTES_PER_LINE = 32;   // 64 hex chars keeps lines under LINE_MAX
+
+  struct Import {
+    bool     open;
+    uint16_t len;
+    uint16_t received;
+    uint32_t crc;                 // running, not yet inverted
+    uint32_t startMs;
+    bool     haveLabels;
+    uint8_t  faderN, stompN, faderGot, stompGot;
+    uint8_t  image[IMAGE_MAX_BYTES];
+    char     fader[MAX_CUSTOM_LABELS][LABEL_MAX_LEN + 1];
+    char     stomp[MAX_CUSTOM_LABELS][LABEL_MAX_LEN + 1];
+  };
+  static Import s_in;
+
+  uint32_t crcUpdate(uint32_t c, const char* p) {
+    while (*p) {
+      c ^= (uint8_t)*p++;
+      for (uint8_t k = 0; k < 8; ++k) c = (c >> 1) ^ (0xEDB88320UL & (0UL - (c & 1)));
+    }
+    return c;
+  }
+  // Every framed line counts with its newline, exactly as the exporter prints it
+  uint32_t crcLine(uint32_t c, const char* line) { return crcUpdate(crcUpdate(c, line), "\n"); }
+
+  int8_t hexNibble(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+  }
+
+  void fail(Print& out, const __FlashStringHelper* why) {
+    s_in.open = false;
+    out.print(F("[cfg] import failed: ")); out.println(why);
+  }
+
+  // Prints one framed line and folds it into the export CRC
+  void emit(Print& out, uint32_t& crc, const char* body) {
+    out.print(F("cfg i ")); out.println(body);
+    crc = crcLine(crc, body);
+  }
+
+  void onData(const char* args, Print& out) {
+    char* hex = nullptr;
+    const unsigned long off = strtoul(args, &hex, 10);
+    while (*hex == ' ') ++hex;
+    if (off != s_in.received) { fail(out, F("data out of order")); return; }
+    size_t n = strlen(hex);
+    if (n == 0 || (n & 1) || n / 2 > BYTES_PER_LINE || off + n / 2 > s_in.len) { fail(out, F("bad data line")); return; }
+    for (size_t i = 0; i < n / 2; ++i) {
+      const int8_t hi = hexNibble(hex[2 * i]), lo = hexNibble(hex[2 * i + 1]);
+      if (hi < 0 || lo < 0) { fail(out, F("bad hex")); return; }
+      s_in.image[off + i] = (uint8_t)((hi << 4) | lo);
+    }
+    s_in.received += (uint16_t)(n / 2);
+  }
+
+  void onLabel(bool stomp, const char* text, Print& out) {
+    uint8_t& got = stomp ? s_in.stompGot : s_in.faderGot;
+    const uint8_t want = stomp ? s_in.stompN : s_in.faderN;
+    if (!s_in.haveLabels || got >= want) { fail(out, F("unexpected label")); return; }
+    char* dst = stomp ? s_in.stomp[got] : s_in.fader[got];
+    strncpy(dst, text, LABEL_MAX_LEN);
+    dst[LABEL_MAX_LEN] = 0;
+    ++got;
+  }
+
+  void onEnd(const char* args, Print& out) {
+    const uint32_t want = strtoul(args, nullptr, 16);
+    const uint32_t got  = ~s_in.crc;
+    if (want != got)                                   { fail(out, F("crc mismatch")); return; }
+    if (s_in.received != s_in.len)                     { fail(out, F("image incomplete")); return; }
+    if (s_in.haveLabels && (s_in.faderGot != s_in.faderN || s_in.stompGot != s_in.stompN)) {
+      fail(out, F("labels incomplete")); return;
+    }
+    // Settings and labels land together or not at all (see importImage)
+    const char* f[MAX_CUSTOM_LABELS]; const char* s[MAX_CUSTOM_LABELS];
+    for (uint8_t i = 0; i < MAX_CUSTOM_LABELS; ++i) { f[i] = s_in.fader[i]; s[i] = s_in.stomp[i]; }
+    if (!settings_module::importImage(s_in.image, s_in.len, s_in.haveLabels ? f : nullptr, s_in.faderN,
+                                      s_in.haveLabels ? s : nullptr, s_in.stompN)) {
+      fail(out, F("image rejected (schema/range)")); return;
+    }
+    s_in.open = false;
+    out.print(F("[cfg] import ok crc=")); out.print(got, HEX);
+    out.print(F(" ms=")); out.println(millis() - s_in.startMs);
+  }
+}
+
+void settings_transfer::exportTo(Print& out) {
+  uint8_t img[IMAGE_MAX_BYTES];
+  const size_t len = settings_module::exportImage(img, sizeof(img));
+  uint32_t crc = 0xFFFFFFFFUL;
+  char body[16 + 2 * BYTES_PER_LINE];
+
+  snprintf(body, sizeof(body), "begin %u %u", (unsigned)settings_module::schemaVersion(), (unsigned)len);
+  emit(out, crc, body);
+  for (size_t off = 0; off < len; off += BYTES_PER_LINE) {
+    int p = snprintf(body, sizeof(body), "d %u ", (unsigned)off);
+    for (size_t i = off; i < len && i < off + BYTES_PER_LINE; ++i) p += snprintf(body + p, sizeof(body) - p, "%02X", img[i]);
+    emit(out, crc, body);
+  }
+
+  const uint8_t nf = settings_module::getCustomFaderLabelCount();
+  const uint8_t ns = settings_module::getCustomStompLabelCount();
+  snprintf(body, sizeof(body), "ln %u %u", (unsigned)nf, (unsigned)ns);
+  emit(out, crc, body);
+  for (uint8_t i = 0; i < nf; ++i) { snprintf(body, sizeof(body), "lf %s", settings_module::getCustomFaderLabel(i)); emit(out, crc, body); }
+  for (uint8_t i = 0; i < ns; ++i) { snprintf(body, sizeof(body), "ls %s", settings_module::getCustomStompLabel(i)); emit(out, crc, body); }
+
+  snprintf(body, sizeof(body), "end %08lX", (unsigned long)~crc);
+  out.print(F("cfg i ")); out.println(body);
+}
+
+void settings_transfer::importLine(const char* line, Print& out) {
+  const char* args = strchr(line, ' ');
+  args = args ? args + 1 : line + strlen(line);
+
+  if (!strncmp(line, "begin ", 6)) {
+    char* rest = nullptr;
+    const unsigned long schema = strtoul(args, &rest, 10);
+    const unsigned long len    = strtoul(rest, nullptr, 10);
+    memset(&s_in, 0, sizeof(s_in));
+    if (schema != settings_module::schemaVersion()) { fail(out, F("schema differs from firmware")); return; }
+    if (len == 0 || len > IMAGE_MAX_BYTES)          { fail(out, F("bad length")); return; }
+    s_in.open    = true;
+    s_in.len     = (uint16_t)len;
+    s_in.crc     = crcLine(0xFFFFFFFFUL, line);
+    s_in.startMs = millis();
+    return;
+  }
+  if (!s_in.open) { out.println(F("[cfg] import: no transfer open (cfg i begin ...)")); return; }
+  if (!strncmp(line, "end ", 4)) { onEnd(args, out); return; }
+
+  s_in.crc = crcLine(s_in.crc, line);
+  if (!strncmp(line, "d ", 2))       onData(args, out);
+  else if (!strncmp(line, "lf ", 3)) onLabel(false, args, out);
+  else if (!strncmp(line, "ls ", 3)) onLabel(true, args, out);
+  else if (!strncmp(line, "ln ", 3)) {
+    char* rest = nullptr;
+    const unsigned long nf = strtoul(args, &rest, 10);
+    const unsigned long ns = strtoul(rest, nullptr, 10);
+    if (nf > MAX_CUSTOM_LABELS || ns > MAX_CUSTOM_LABELS) { fail(out, F("too many labels")); return; }
+    s_in.haveLabels = true;
+    s_in.faderN = (uint8_t)nf; s_in.stompN = (uint8_t)ns;
+  }
+  else fail(out, F("unknown line"));
+}
@@ -0,0 +1,22 @@
+// =============================
+// File: src/settings_transfer.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// Text-framed settings export/import over the serial console, for cloning or
+// provisioning a unit without the encoder. An export is a list of console
+// commands that, sent back verbatim, re-creates the same settings:
+//
+//   cfg i begin <schema> <len>      image header
+//   cfg i d <offset> <hex>          up to 32 image bytes, in order
+//   cfg i ln <faders> <stomps>      custom label counts (optional section)
+//   cfg i lf <text> / cfg i ls <text>
+//   cfg i end <crc32>               CRC-32 of every line text after "cfg i "
+//
+// Nothing is applied until "end" checks out; then the blob is committed in
+// one write and the device replies "[cfg] import ok crc=<crc32>".
+namespace settings_transfer {
+  void exportTo(Print& out);
+  void importLine(const char* line, Print& out);   // the text after "cfg i "
+}
@@ -10,14 +10,12 @@
 #include "fonts/OpenSans_SemiBold14pt7b.h"
 #include "layout_constants.h"
 #include "setup_module.h"   // for clearBetweenTriangles()
+#include "brightness_module.h"
 
 using display_module::tft;
 
-// Perceptual LED curve (gamma ~2.6) with better top-end spread
-const uint8_t LED_PWM_TABLE[21] = {
-  0, 1, 2, 3, 5, 7, 11, 17, 24, 32, 42,
-  54, 68, 83, 101, 121, 143, 167, 194, 223, 255
-};
+// Duty curve lives in brightness_module (12-bit LEDC, gamma ~2.6)
+static constexpr uint16_t PREVIEW_FADE_MS = 60;
 
 static uint8_t s_current = 20;
 static uint8_t s_edit    = 20;
@@ -123,14 +121,15 @@ static void drawBottomLabel(const char* txt) {
 }
 
 void setup_led::begin() {
-  pinMode(pinmap::LED_PWM, OUTPUT);
   s_current = clamp020(load_brightness());
   s_edit    = s_current;
   s_lastEditDraw = 255; // force first delta draw
-  analogWrite(pinmap::LED_PWM, LED_PWM_TABLE[s_current]);
+  brightness_module::setLevel(brightness_module::Channel::Leds, s_current);
 }
 
-void setup_led::apply_pwm() { analogWrite(pinmap::LED_PWM, LED_PWM_TABLE[s_current]); }
+void setup_led::apply_pwm() {
+  brightness_module::setLevel(brightness_module::Channel::Leds, s_current, PREVIEW_FADE_MS);
+}
 uint8_t setup_led::get_current() { return s_current; }
 uint8_t setup_led::get_edit()    { return s_edit; }
 
@@ -158,7 +157,7 @@ void setup_led::on_encoder_turn(int8_t dir) {
 
   if (nextVal != prev) {
     s_edit = nextVal;
-    analogWrite(pinmap::LED_PWM, LED_PWM_TABLE[s_edit]);
+    brightness_module::setLevel(brightness_module::Channel::Leds, s_edit, PREVIEW_FADE_MS); // live preview
     drawValue(s_edit);
     if (s_lastEditDraw == 255) {
       drawBarFull(s_edit, ST77XX_RED, true);
@@ -174,7 +173,6 @@ void setup_led::on_toggle(int8_t dir) { on_encoder_turn(dir); }
 void setup_led::on_encoder_press() {
   if (!s_inEdit) { s_edit = s_current; show_led_brightness(); return; }
   s_current = s_edit;
-  save_brightness(s_current);
-  apply_pwm();
+  save_brightness(s_current);   // brightness_module follows the setting
   show_led();
 }
\ No newline at end of file
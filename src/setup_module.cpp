@@ -1,10 +1,9 @@
 // =============================
-// File: src/setup_module.cpp — v5.1 (adds Stomp CC after Fader CC)
+// File: src/setup_module.cpp — v6 (table-driven screen graph)
 // Notes:
-//  • Inserts a new root item "Stomp CC" AFTER the existing "Fader CC" root.
-//  • Adds three detail screens for Stomp: root → select → edit.
-//  • Forwards encoder/toggle events to setup_stomp_cc on those screens.
-//  • Calls setup_stomp_cc::begin() during setup_module::begin().
+//  • Navigation, show and event routing come from the constexpr SCREENS table;
+//    every event is one indexed lookup instead of an if-chain per screen.
+//  • Screen ids (IDX_*) and root order are unchanged from v5.1.
 // Keep your existing includes/ordering if different; this file is self-contained.
 // =============================
 
@@ -14,7 +13,6 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST77XX.h>
 #include "display_module.h"
-#include "mirror_module.h"
 #include "settings_module.h"
 #include "fonts/OpenSans_SemiBold14pt7b.h"
 #include "pinmap_module.h"
@@ -65,52 +63,101 @@ static bool headerDrawn  = false;
 static int8_t triMode    = -1;
 static int s_contentTop = LINE_Y + LINE_THICKNESS + 2;
 
-// Existing detail indices kept
+// Screen ids (stable; rows in SCREENS below are indexed by these)
+static constexpr int IDX_BATTERY         = 0;
+static constexpr int IDX_LED_ROOT        = 1;
+static constexpr int IDX_LED_EDIT        = 2;
+static constexpr int IDX_TFT_ROOT        = 3;
+static constexpr int IDX_TFT_EDIT        = 4;
 static constexpr int IDX_MIRROR_ROOT     = 5;
 static constexpr int IDX_MIRROR_EDIT     = 6;
 static constexpr int IDX_MIDI_CH_ROOT    = 7;
 static constexpr int IDX_MIDI_CH_SELECT  = 8;
 static constexpr int IDX_MIDI_CH_EDIT    = 9;
-
-// Fader CC (existing)
 static constexpr int IDX_FADER_CC_ROOT   = 10;
 static constexpr int IDX_FADER_CC_SELECT = 11;
 static constexpr int IDX_FADER_CC_EDIT   = 12;
-
-// NEW: Stomp CC (three screens), placed AFTER Fader CC
 static constexpr int IDX_STOMP_CC_ROOT   = 13;
 static constexpr int IDX_STOMP_CC_SELECT = 14;
 static constexpr int IDX_STOMP_CC_EDIT   = 15;
+static constexpr int SCREEN_COUNT        = 16;
+
+// --- Screen graph ----------------------------------------------------------
+// One row per screen. Root screens (detail == false) are navigated by turn /
+// toggle in ROOT_ORDER; detail screens forward turn / toggle to their handler.
+// Press runs `press` (if any) and then moves to `pressTo` (-1 = stay).
+// Adding a screen = one id, one row, and (for a root) one ROOT_ORDER entry.
+typedef void (*ShowFn)();
+typedef void (*DirFn)(int8_t dir);
+
+struct Screen {
+  int8_t id;        // must equal the row index (checked below)
+  bool   detail;
+  ShowFn show;
+  DirFn  turn;      // detail screens only
+  DirFn  toggle;    // detail screens only
+  ShowFn press;     // commit action before moving on (optional)
+  int8_t pressTo;
+  ShowFn tick;      // called from update() while shown (optional)
+};
+
+static constexpr Screen SCREENS[SCREEN_COUNT] = {
+  { IDX_BATTERY,         false, setup_battery::begin,                    nullptr,                            nullptr,                      nullptr,                              -1,                  setup_battery::update },
+  { IDX_LED_ROOT,        false, setup_led::show_led,                     nullptr,                            nullptr,                      nullptr,                              IDX_LED_EDIT,        nullptr },
+  { IDX_LED_EDIT,        true,  setup_led::show_led_brightness,          setup_led::on_encoder_turn,         setup_led::on_toggle,         setup_led::on_encoder_press,          IDX_LED_ROOT,        nullptr },
+  { IDX_TFT_ROOT,        false, setup_tft::show_tft,                     nullptr,                            nullptr,                      nullptr,                              IDX_TFT_EDIT,        nullptr },
+  { IDX_TFT_EDIT,        true,  setup_tft::show_tft_brightness,          setup_tft::on_encoder_turn,         setup_tft::on_toggle,         setup_tft::on_encoder_press,          IDX_TFT_ROOT,        nullptr },
+  { IDX_MIRROR_ROOT,     false, setup_mirror_delay::show_mirror,         nullptr,                            nullptr,                      nullptr,                              IDX_MIRROR_EDIT,     nullptr },
+  { IDX_MIRROR_EDIT,     true,  setup_mirror_delay::show_mirror_select,  setup_mirror_delay::on_encoder_turn, setup_mirror_delay::on_toggle, setup_mirror_delay::on_encoder_press, IDX_MIRROR_ROOT,     nullptr },
+  { IDX_MIDI_CH_ROOT,    false, setup_midi_ch::show_midi_ch,             nullptr,                            nullptr,                      nullptr,                              IDX_MIDI_CH_SELECT,  nullptr },
+  { IDX_MIDI_CH_SELECT,  true,  setup_midi_ch::show_midi_ch_select,      setup_midi_ch::on_encoder_turn,     setup_midi_ch::on_toggle,     nullptr,                              IDX_MIDI_CH_EDIT,    nullptr },
+  { IDX_MIDI_CH_EDIT,    true,  setup_midi_ch::show_midi_ch_confirmation, setup_midi_ch::on_encoder_turn,    setup_midi_ch::on_toggle,     setup_midi_ch::on_encoder_press,      IDX_MIDI_CH_ROOT,    nullptr },
+  { IDX_FADER_CC_ROOT,   false, setup_fader_cc::show_fader_cc,           nullptr,                            nullptr,                      nullptr,                              IDX_FADER_CC_SELECT, nullptr },
+  { IDX_FADER_CC_SELECT, true,  setup_fader_cc::show_fader_cc_select,    setup_fader_cc::on_encoder_turn,    setup_fader_cc::on_toggle,    nullptr,                              IDX_FADER_CC_EDIT,   nullptr },
+  { IDX_FADER_CC_EDIT,   true,  setup_fader_cc::show_fader_cc_edit,      setup_fader_cc::on_encoder_turn,    setup_fader_cc::on_toggle,    setup_fader_cc::on_encoder_press,     IDX_FADER_CC_ROOT,   nullptr },
+  { IDX_STOMP_CC_ROOT,   false, setup_stomp_cc::show_stomp_cc,           nullptr,                            nullptr,                      nullptr,                              IDX_STOMP_CC_SELECT, nullptr },
+  { IDX_STOMP_CC_SELECT, true,  setup_stomp_cc::show_stomp_cc_select,    setup_stomp_cc::on_encoder_turn,    setup_stomp_cc::on_toggle,    nullptr,                              IDX_STOMP_CC_EDIT,   nullptr },
+  { IDX_STOMP_CC_EDIT,   true,  setup_stomp_cc::show_stomp_cc_edit,      setup_stomp_cc::on_encoder_turn,    setup_stomp_cc::on_toggle,    setup_stomp_cc::on_encoder_press,     IDX_STOMP_CC_ROOT,   nullptr },
+};
+
+// Root pages in turn order (wraps both ways)
+static constexpr int8_t ROOT_ORDER[] = {
+  IDX_BATTERY, IDX_LED_ROOT, IDX_TFT_ROOT, IDX_MIRROR_ROOT,
+  IDX_MIDI_CH_ROOT, IDX_FADER_CC_ROOT, IDX_STOMP_CC_ROOT
+};
+static constexpr int ROOT_COUNT = sizeof(ROOT_ORDER) / sizeof(ROOT_ORDER[0]);
 
-static inline bool isDetail(int idx) {
-  return (idx == 2) || (idx == 4) ||
-         (idx == IDX_MIRROR_EDIT) ||
-         (idx == IDX_MIDI_CH_SELECT) || (idx == IDX_MIDI_CH_EDIT) ||
-         (idx == IDX_FADER_CC_SELECT) || (idx == IDX_FADER_CC_EDIT) ||
-         (idx == IDX_STOMP_CC_SELECT) || (idx == IDX_STOMP_CC_EDIT);
+// Position of each screen in ROOT_ORDER (-1 for detail screens), built at compile time
+struct RootSlots { int8_t pos[SCREEN_COUNT]; };
+static constexpr RootSlots makeRootSlots() {
+  RootSlots r{};
+  for (int i = 0; i < SCREEN_COUNT; ++i) r.pos[i] = -1;
+  for (int k = 0; k < ROOT_COUNT; ++k) r.pos[ROOT_ORDER[k]] = (int8_t)k;
+  return r;
 }
+static constexpr RootSlots ROOT_SLOTS = makeRootSlots();
+
+static constexpr bool tableIsConsistent() {
+  for (int i = 0; i < SCREEN_COUNT; ++i) {
+    if (SCREENS[i].id != i) return false;
+    if (SCREENS[i].detail != (ROOT_SLOTS.pos[i] < 0)) return false;
+    if (SCREENS[i].detail && (!SCREENS[i].turn || !SCREENS[i].toggle)) return false;
+    if (SCREENS[i].pressTo >= SCREEN_COUNT) return false;
+  }
+  return true;
+}
+static_assert(tableIsConsistent(), "setup SCREENS rows out of order, or ROOT_ORDER disagrees with detail flags");
+
+static inline bool isValid(int idx) { return idx >= 0 && idx < SCREEN_COUNT; }
+static inline bool isDetail(int idx) { return isValid(idx) && SCREENS[idx].detail; }
 
 static inline int nextRoot(int idx) {
-  // Root pages in order: 0(batt) -> 1(led) -> 3(tft) -> mirror -> midi_ch -> fader_cc -> stomp_cc -> 0
-  if (idx <= 0) return 1;
-  if (idx == 1) return 3;
-  if (idx == 3) return IDX_MIRROR_ROOT;
-  if (idx == IDX_MIRROR_ROOT) return IDX_MIDI_CH_ROOT;
-  if (idx == IDX_MIDI_CH_ROOT) return IDX_FADER_CC_ROOT;
-  if (idx == IDX_FADER_CC_ROOT) return IDX_STOMP_CC_ROOT;   // NEW
-  if (idx == IDX_STOMP_CC_ROOT) return 0;                    // NEW wrap
-  return 0;
+  const int p = isValid(idx) ? ROOT_SLOTS.pos[idx] : -1;
+  return p < 0 ? ROOT_ORDER[0] : ROOT_ORDER[(p + 1) % ROOT_COUNT];
 }
 static inline int prevRoot(int idx) {
-  // Reverse of nextRoot
-  if (idx <= 0) return IDX_STOMP_CC_ROOT;                    // NEW
-  if (idx == IDX_STOMP_CC_ROOT) return IDX_FADER_CC_ROOT;    // NEW
-  if (idx == IDX_FADER_CC_ROOT) return IDX_MIDI_CH_ROOT;
-  if (idx == IDX_MIDI_CH_ROOT) return IDX_MIRROR_ROOT;
-  if (idx == IDX_MIRROR_ROOT) return 3;
-  if (idx == 3) return 1;
-  if (idx == 1) return 0;
-  return 0;
+  const int p = isValid(idx) ? ROOT_SLOTS.pos[idx] : -1;
+  return p <= 0 ? ROOT_ORDER[ROOT_COUNT - 1] : ROOT_ORDER[p - 1];
 }
 
 static void drawStaticHeader() {
@@ -180,25 +227,7 @@ static void showMenuIndex(int idx) {
   clearContent(wantTriangles);
   setTrianglesVisible(wantTriangles);
 
-  switch (idx) {
-    case 0: setup_battery::begin(); break;
-    case 1: setup_led::show_led(); break;
-    case 2: setup_led::show_led_brightness(); break;
-    case 3: setup_tft::show_tft(); break;
-    case 4: setup_tft::show_tft_brightness(); break;
-    case IDX_MIRROR_ROOT:     setup_mirror_delay::show_mirror(); break;
-    case IDX_MIRROR_EDIT:     setup_mirror_delay::show_mirror_select(); break;
-    case IDX_MIDI_CH_ROOT:    setup_midi_ch::show_midi_ch(); break;
-    case IDX_MIDI_CH_SELECT:  setup_midi_ch::show_midi_ch_select(); break;
-    case IDX_MIDI_CH_EDIT:    setup_midi_ch::show_midi_ch_confirmation(); break;
-    case IDX_FADER_CC_ROOT:   setup_fader_cc::show_fader_cc(); break;
-    case IDX_FADER_CC_SELECT: setup_fader_cc::show_fader_cc_select(); break;
-    case IDX_FADER_CC_EDIT:   setup_fader_cc::show_fader_cc_edit(); break;
-    case IDX_STOMP_CC_ROOT:   setup_stomp_cc::show_stomp_cc(); break;         // NEW
-    case IDX_STOMP_CC_SELECT: setup_stomp_cc::show_stomp_cc_select(); break; // NEW
-    case IDX_STOMP_CC_EDIT:   setup_stomp_cc::show_stomp_cc_edit(); break;   // NEW
-    default: break;
-  }
+  if (isValid(idx)) SCREENS[idx].show();
 }
 
 void begin() {
@@ -218,67 +247,36 @@ void begin() {
   showMenuIndex(currentMenuIndex);
 }
 
+void end() {
+  inSetupMode = false;
+}
+
 void update() {
-  if (mirror_module::pressedLong()) { begin(); }
-  if (!inSetupMode) return;
-  switch (currentMenuIndex) {
-    case 0: setup_battery::update(); break;
-    default: break;
-  }
+  if (!inSetupMode || !isValid(currentMenuIndex)) return;
+  if (SCREENS[currentMenuIndex].tick) SCREENS[currentMenuIndex].tick();
 }
 
 void onEncoderTurn(int8_t dir) {
-  if (!inSetupMode || dir == 0) return;
-  if (isDetail(currentMenuIndex)) {
-    if (currentMenuIndex == 2) { setup_led::on_encoder_turn(dir); return; }
-    if (currentMenuIndex == 4) { setup_tft::on_encoder_turn(dir); return; }
-    if (currentMenuIndex == IDX_MIRROR_EDIT) { setup_mirror_delay::on_encoder_turn(dir); return; }
-    if (currentMenuIndex == IDX_MIDI_CH_SELECT || currentMenuIndex == IDX_MIDI_CH_EDIT) {
-      setup_midi_ch::on_encoder_turn(dir); return; }
-    if (currentMenuIndex == IDX_FADER_CC_SELECT || currentMenuIndex == IDX_FADER_CC_EDIT) {
-      setup_fader_cc::on_encoder_turn(dir); return; }
-    if (currentMenuIndex == IDX_STOMP_CC_SELECT || currentMenuIndex == IDX_STOMP_CC_EDIT) { // NEW
-      setup_stomp_cc::on_encoder_turn(dir); return; }
-  }
+  if (!inSetupMode || dir == 0 || !isValid(currentMenuIndex)) return;
+  const Screen& s = SCREENS[currentMenuIndex];
+  if (s.detail) { s.turn(dir); return; }
   currentMenuIndex = (dir > 0) ? nextRoot(currentMenuIndex) : prevRoot(currentMenuIndex);
   showMenuIndex(currentMenuIndex);
 }
 
 void onEncoderPress() {
-  if (!inSetupMode) return;
-
-  if (currentMenuIndex == 1) { currentMenuIndex = 2; showMenuIndex(currentMenuIndex); return; }
-  if (currentMenuIndex == 2) { setup_led::on_encoder_press(); currentMenuIndex = 1; showMenuIndex(currentMenuIndex); return; }
-
-  if (currentMenuIndex == 3) { currentMenuIndex = 4; showMenuIndex(currentMenuIndex); return; }
-  if (currentMenuIndex == 4) { setup_tft::on_encoder_press(); currentMenuIndex = 3; showMenuIndex(currentMenuIndex); return; }
-
-  if (currentMenuIndex == IDX_MIRROR_ROOT) { currentMenuIndex = IDX_MIRROR_EDIT; showMenuIndex(currentMenuIndex); return; }
-  if (currentMenuIndex == IDX_MIRROR_EDIT) { setup_mirror_delay::on_encoder_press(); currentMenuIndex = IDX_MIRROR_ROOT; showMenuIndex(currentMenuIndex); return; }
-
-  if (currentMenuIndex == IDX_MIDI_CH_ROOT)   { currentMenuIndex = IDX_MIDI_CH_SELECT; showMenuIndex(currentMenuIndex); return; }
-  if (currentMenuIndex == IDX_MIDI_CH_SELECT) { currentMenuIndex = IDX_MIDI_CH_EDIT;   showMenuIndex(currentMenuIndex); return; }
-  if (currentMenuIndex == IDX_MIDI_CH_EDIT)   { setup_midi_ch::on_encoder_press();     currentMenuIndex = IDX_MIDI_CH_ROOT; showMenuIndex(currentMenuIndex); return; }
-
-  if (currentMenuIndex == IDX_FADER_CC_ROOT)   { currentMenuIndex = IDX_FADER_CC_SELECT; showMenuIndex(currentMenuIndex); return; }
-  if (currentMenuIndex == IDX_FADER_CC_SELECT) { currentMenuIndex = IDX_FADER_CC_EDIT;   showMenuIndex(currentMenuIndex); return; }
-  if (currentMenuIndex == IDX_FADER_CC_EDIT)   { setup_fader_cc::on_encoder_press();     currentMenuIndex = IDX_FADER_CC_ROOT; showMenuIndex(currentMenuIndex); return; }
-
-  if (currentMenuIndex == IDX_STOMP_CC_ROOT)   { currentMenuIndex = IDX_STOMP_CC_SELECT; showMenuIndex(currentMenuIndex); return; }   // NEW
-  if (currentMenuIndex == IDX_STOMP_CC_SELECT) { currentMenuIndex = IDX_STOMP_CC_EDIT;   showMenuIndex(currentMenuIndex); return; }   // NEW
-  if (currentMenuIndex == IDX_STOMP_CC_EDIT)   { setup_stomp_cc::on_encoder_press();     currentMenuIndex = IDX_STOMP_CC_ROOT; showMenuIndex(currentMenuIndex); return; }   // NEW
+  if (!inSetupMode || !isValid(currentMenuIndex)) return;
+  const Screen& s = SCREENS[currentMenuIndex];
+  if (s.press) s.press();
+  if (s.pressTo < 0) return;
+  currentMenuIndex = s.pressTo;
+  showMenuIndex(currentMenuIndex);
 }
 
 void onToggle(int8_t dir) {
-  if (!inSetupMode || dir == 0) return;
-  if (isDetail(currentMenuIndex)) {
-    if (currentMenuIndex == 2) { setup_led::on_toggle(dir); return; }
-    if (currentMenuIndex == 4) { setup_tft::on_toggle(dir); return; }
-    if (currentMenuIndex == IDX_MIRROR_EDIT) { setup_mirror_delay::on_toggle(dir); return; }
-    if (currentMenuIndex == IDX_MIDI_CH_SELECT || currentMenuIndex == IDX_MIDI_CH_EDIT) { setup_midi_ch::on_toggle(dir); return; }
-    if (currentMenuIndex == IDX_FADER_CC_SELECT || currentMenuIndex == IDX_FADER_CC_EDIT) { setup_fader_cc::on_toggle(dir); return; }
-    if (currentMenuIndex == IDX_STOMP_CC_SELECT || currentMenuIndex == IDX_STOMP_CC_EDIT) { setup_stomp_cc::on_toggle(dir); return; } // NEW
-  }
+  if (!inSetupMode || dir == 0 || !isValid(currentMenuIndex)) return;
+  const Screen& s = SCREENS[currentMenuIndex];
+  if (s.detail) { s.toggle(dir); return; }
   onEncoderTurn(dir);
 }
 
@@ -11,6 +11,7 @@ namespace setup_module {
 
   // Lifecycle
   void begin();   // called once when entering Setup mode
+  void end();     // leaving Setup mode: input hooks go quiet
   void update();  // called regularly while in Setup mode
 
   // Input hooks for Setup mode (to be called by your input/router)
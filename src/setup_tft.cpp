@@ -10,16 +10,13 @@
 #include "fonts/OpenSans_SemiBold14pt7b.h"
 #include "layout_constants.h"
 #include "setup_module.h"   // for clearBetweenTriangles()
+#include "brightness_module.h"
 
 using display_module::tft;
 
-// Perceptual PWM table (1..20). No true OFF to avoid lockout.
-// Index 0 is unused. Index 1 is a minimal but visible glow; 20 is full.
-static const uint8_t TFT_PWM_TABLE[21] = {
-  /*0 (unused)*/ 0,
-  /*1*/ 2, 3, 6, 10, 15, 22, 30, 40, 52, 68,
-  /*11*/ 86, 108, 134, 164, 190, 208, 224, 238, 248, 255
-};
+// Duty curve lives in brightness_module (12-bit LEDC). Level 1..20, no true
+// OFF to avoid lockout.
+static constexpr uint16_t PREVIEW_FADE_MS = 60;
 
 // Local state
 static uint8_t s_current = 20;     // committed value 1..20
@@ -121,14 +118,15 @@ static void drawBottomLabel(const char* txt) {
 }
 
 void setup_tft::begin() {
-  pinMode(pinmap::TFT_BL_PWM, OUTPUT);
   s_current = clamp120(load_brightness());
   s_edit    = s_current;
   s_lastEditDraw = 255; // force first delta draw
-  analogWrite(pinmap::TFT_BL_PWM, TFT_PWM_TABLE[s_current]);
+  brightness_module::setLevel(brightness_module::Channel::Backlight, s_current);
 }
 
-void setup_tft::apply_pwm() { analogWrite(pinmap::TFT_BL_PWM, TFT_PWM_TABLE[s_current]); }
+void setup_tft::apply_pwm() {
+  brightness_module::setLevel(brightness_module::Channel::Backlight, s_current, PREVIEW_FADE_MS);
+}
 uint8_t setup_tft::get_current() { return s_current; }
 uint8_t setup_tft::get_edit()    { return s_edit; }
 
@@ -156,7 +154,7 @@ void setup_tft::on_encoder_turn(int8_t dir) {
 
   if (nextVal != prev) {
     s_edit = nextVal;
-    analogWrite(pinmap::TFT_BL_PWM, TFT_PWM_TABLE[s_edit]); // live preview
+    brightness_module::setLevel(brightness_module::Channel::Backlight, s_edit, PREVIEW_FADE_MS); // live preview
     drawValue(s_edit);
     if (s_lastEditDraw == 255) {
       drawBarFull(s_edit, ST77XX_RED, true);
@@ -172,7 +170,6 @@ void setup_tft::on_toggle(int8_t dir) { on_encoder_turn(dir); }
 void setup_tft::on_encoder_press() {
   if (!s_inEdit) { s_edit = s_current; show_tft_brightness(); return; }
   s_current = s_edit;
-  save_brightness(s_current);
-  apply_pwm();
+  save_brightness(s_current);   // brightness_module follows the setting
   show_tft();
 }
\ No newline at end of file
@@ -0,0 +1,57 @@
+// =============================
+// File: src/stomp_module.cpp
+// =============================
+#include "stomp_module.h"
+#include "mux_module.h"
+#include "settings_module.h"
+#include "midi_out.h"
+#include "tempo_module.h"
+
+namespace {
+  static const unsigned long DEBOUNCE_MS = 15;
+
+  static bool          s_raw[stomp_module::COUNT];
+  static bool          s_pressed[stomp_module::COUNT];
+  static unsigned long s_rawTs[stomp_module::COUNT];
+  static bool          s_on[stomp_module::COUNT];
+  static bool          s_begun = false;
+
+  inline bool readStomp(uint8_t i) {
+    return mux_module::read_input((mux_module::MuxInput)((uint8_t)mux_module::MuxInput::Stomp1 + i));
+  }
+
+  void sendState(uint8_t i, bool on) {
+    s_on[i] = on;
+    midi_out::controlChange(settings_module::getStompCC(i), on ? 127 : 0, midi_out::Priority::Stomp);
+  }
+}
+
+void stomp_module::begin() {
+  if (s_begun) return;
+  s_begun = true;
+  for (uint8_t i = 0; i < COUNT; ++i) {
+    s_raw[i] = s_pressed[i] = readStomp(i);   // a switch held at power-up sends nothing until released
+    s_rawTs[i] = millis();
+    s_on[i] = false;
+  }
+}
+
+void stomp_module::update() {
+  if (!s_begun) return;
+  const unsigned long now = millis();
+  for (uint8_t i = 0; i < COUNT; ++i) {
+    const bool raw = readStomp(i);
+    if (raw != s_raw[i]) { s_raw[i] = raw; s_rawTs[i] = now; continue; }
+    if (raw == s_pressed[i] || now - s_rawTs[i] < DEBOUNCE_MS) continue;
+    s_pressed[i] = raw;
+    if (raw && settings_module::getStompCC(i) == TEMPO_TAP_CC) tempo_module::tap(micros());
+
+    const bool toggle = settings_module::getStompType(i) == 1;
+    if (toggle) { if (raw) sendState(i, !s_on[i]); }
+    else        sendState(i, raw);
+  }
+}
+
+bool stomp_module::on(uint8_t stomp) {
+  return stomp < COUNT && s_on[stomp];
+}
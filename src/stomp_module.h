@@ -0,0 +1,18 @@
+// =============================
+// File: src/stomp_module.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+// The four stomp switches (via the mux). Each sends its CC from
+// settings_module at Stomp priority: momentary = 127 while held, 0 on
+// release; toggle = alternates 127/0 per press. A stomp on TEMPO_TAP_CC
+// also taps tempo_module on each press.
+namespace stomp_module {
+  constexpr uint8_t COUNT = 4;
+
+  void begin();
+  void update();
+
+  bool on(uint8_t stomp);   // last state sent
+}
@@ -0,0 +1,148 @@
+// =============================
+// File: src/tempo_module.cpp
+// =============================
+#include "tempo_module.h"
+#include "midi_din.h"
+#include "midi_ble.h"
+#include "driver/gptimer.h"
+
+using tempo_module::PPQN;
+using tempo_module::TapTempo;
+
+namespace {
+  static constexpr uint32_t TIMER_HZ = 1000000;   // 1 us timer resolution
+  static constexpr uint8_t  BLE_RING = 32;        // > one BLE connection interval of ticks at 240 BPM
+  static_assert((BLE_RING & (BLE_RING - 1)) == 0, "BLE_RING must be a power of two");
+
+  static gptimer_handle_t s_timer = nullptr;
+  static portMUX_TYPE s_mux = portMUX_INITIALIZER_UNLOCKED;
+  static TapTempo    s_tap;
+  static uint32_t    s_beatUs = 0;     // 0 = no tempo, clock off
+  static bool        s_playing = false;
+  static bool        s_begun = false;
+
+  // Realtime message for the next tick (start/stop/continue), 0 = none.
+  // Written under s_mux from loop(), taken by the ISR.
+  static volatile uint8_t s_pendingRt = 0;
+
+  // Tick stamps for BLE: ISR writes head, update() reads tail
+  struct Stamp { uint16_t ms; uint8_t status; };
+  static Stamp             s_ble[BLE_RING];
+  static volatile uint8_t  s_bleHead = 0;
+  static volatile uint8_t  s_bleTail = 0;
+
+  static volatile uint32_t s_ticks = 0, s_dinDropped = 0, s_bleDropped = 0;
+  static tempo_module::Stats s_stats = {};
+
+  inline void IRAM_ATTR stamp(uint16_t ms, uint8_t status) {
+    const uint8_t h = s_bleHead;
+    if ((uint8_t)(h - s_bleTail) >= BLE_RING) { ++s_bleDropped; return; }
+    s_ble[h & (BLE_RING - 1)] = { ms, status };
+    s_bleHead = (uint8_t)(h + 1);
+  }
+
+  // Timer interrupt, once per clock. Nothing here waits on loop(): the DIN
+  // bytes go straight to the UART FIFO, BLE gets a timestamp to send later.
+  bool IRAM_ATTR onTick(gptimer_handle_t, const gptimer_alarm_event_data_t*, void*) {
+    uint8_t msg[2];
+    uint8_t n = 0;
+    portENTER_CRITICAL_ISR(&s_mux);
+    if (s_pendingRt) { msg[n++] = s_pendingRt; s_pendingRt = 0; }
+    portEXIT_CRITICAL_ISR(&s_mux);
+    msg[n++] = 0xF8;
+    ++s_ticks;
+    if (!midi_din::realtimeFromIsr(msg, n)) ++s_dinDropped;
+    const uint16_t ms = (uint16_t)millis();
+    for (uint8_t i = 0; i < n; ++i) stamp(ms, msg[i]);
+    return false;   // no task woken
+  }
+
+  // Rounded to the timer's 1 us: at most 0.5 us per clock, 12 us per beat
+  void applyTempo(uint32_t beatUs) {
+    if (!s_timer) return;
+    if (!beatUs) { if (s_beatUs) gptimer_stop(s_timer); s_beatUs = 0; return; }
+    const bool wasOff = s_beatUs == 0;
+    s_beatUs = beatUs;
+    gptimer_alarm_config_t alarm = {};
+    alarm.alarm_count = (beatUs + PPQN / 2) / PPQN;
+    alarm.reload_count = 0;
+    alarm.flags.auto_reload_on_alarm = true;
+    gptimer_set_alarm_action(s_timer, &alarm);
+    if (wasOff) { gptimer_set_raw_count(s_timer, 0); gptimer_start(s_timer); }
+  }
+
+  void queueRealtime(uint8_t status) {
+    portENTER_CRITICAL(&s_mux);
+    s_pendingRt = status;
+    portEXIT_CRITICAL(&s_mux);
+  }
+}
+
+void tempo_module::begin() {
+  if (s_begun) return;
+  s_begun = true;
+  // gptimer rather than the Arduino timer API, which cannot set the level:
+  // onTick must run at midi_din::ISR_LEVEL on loop()'s core, like the UART
+  // driver (see midi_din::realtimeFromIsr)
+  gptimer_config_t cfg = {};
+  cfg.clk_src = GPTIMER_CLK_SRC_DEFAULT;
+  cfg.direction = GPTIMER_COUNT_UP;
+  cfg.resolution_hz = TIMER_HZ;
+  cfg.intr_priority = midi_din::ISR_LEVEL;
+  if (gptimer_new_timer(&cfg, &s_timer) != ESP_OK) { s_timer = nullptr; return; }
+  gptimer_event_callbacks_t cbs = {};
+  cbs.on_alarm = onTick;
+  gptimer_register_event_callbacks(s_timer, &cbs, nullptr);
+  gptimer_enable(s_timer);
+}
+
+void tempo_module::update() {
+  if (!s_begun) return;
+  const bool ble = midi_ble::connected();
+  while (s_bleTail != s_bleHead) {
+    const Stamp st = s_ble[s_bleTail & (BLE_RING - 1)];
+    // A full packet is flushed by sendAt(); a refusal means no central
+    if (ble && !midi_ble::sendAt(st.ms, st.status)) ++s_bleDropped;
+    s_bleTail = (uint8_t)(s_bleTail + 1);
+  }
+}
+
+void tempo_module::tap(uint32_t nowUs) {
+  const uint32_t beat = s_tap.tap(nowUs);
+  if (beat) applyTempo(beat);
+}
+
+void tempo_module::setBpm(float bpm) {
+  if (!(bpm > 0.0f)) { applyTempo(0); return; }
+  if (bpm < 30.0f) bpm = 30.0f; else if (bpm > 240.0f) bpm = 240.0f;
+  applyTempo((uint32_t)(60000000.0f / bpm + 0.5f));
+}
+
+float tempo_module::bpm() { return s_beatUs ? 60000000.0f / (float)s_beatUs : 0.0f; }
+uint32_t tempo_module::beatUs() { return s_beatUs; }
+
+void tempo_module::start()  { s_playing = true;  queueRealtime(0xFA); }
+void tempo_module::stop()   { s_playing = false; queueRealtime(0xFC); }
+void tempo_module::resume() { s_playing = true;  queueRealtime(0xFB); }
+bool tempo_module::playing() { return s_playing; }
+
+const tempo_module::Stats& tempo_module::stats() {
+  s_stats.ticks      = s_ticks;
+  s_stats.dinDropped = s_dinDropped;
+  s_stats.bleDropped = s_bleDropped;
+  s_stats.taps       = s_tap.taps;
+  s_stats.outliers   = s_tap.outliers;
+  return s_stats;
+}
+
+void tempo_module::printStats(Print& out) {
+  const Stats& s = stats();
+  out.print(F("[tempo] bpm=")); out.print(bpm(), 2);
+  out.print(F(" tick_us=")); out.print(s_beatUs ? (s_beatUs + PPQN / 2) / PPQN : 0);
+  out.print(F(" ")); out.print(s_playing ? F("playing") : F("stopped"));
+  out.print(F(" ticks=")); out.print(s.ticks);
+  out.print(F(" din_drop=")); out.print(s.dinDropped);
+  out.print(F(" ble_drop=")); out.print(s.bleDropped);
+  out.print(F(" taps=")); out.print(s.taps);
+  out.print(F(" outliers=")); out.println(s.outliers);
+}
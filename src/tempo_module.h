@@ -0,0 +1,112 @@
+// =============================
+// File: src/tempo_module.h
+// =============================
+#pragma once
+#include <Arduino.h>
+
+#ifndef TEMPO_TAP_CC
+#define TEMPO_TAP_CC 30         // a stomp on this CC taps tempo (Kemper: CC 30 Tap Tempo)
+#endif
+
+// Tap tempo and MIDI clock. Presses of a stomp assigned TEMPO_TAP_CC set the
+// tempo (TapTempo); from then on a hardware timer interrupt emits 24 ppqn
+// clock. On DIN the ISR writes each clock byte straight into the UART FIFO
+// (midi_din::realtimeFromIsr), so its timing does not depend on loop() load
+// or display redraws; for BLE it queues the tick time and update() sends it
+// with that timestamp. start()/stop()/resume() go out at the next tick, a
+// start immediately followed by the clock that marks beat one. The clock
+// keeps running while stopped so receivers stay locked.
+namespace tempo_module {
+  constexpr uint8_t PPQN = 24;
+
+  void begin();
+  void update();           // BLE clock queue, tempo changes
+
+  void tap(uint32_t nowUs);
+  void setBpm(float bpm);  // 30..240; 0 stops the clock
+  float    bpm();          // 0 until a tempo is set
+  uint32_t beatUs();
+
+  void start();            // 0xFA
+  void stop();             // 0xFC
+  void resume();           // 0xFB
+  bool playing();
+
+  struct Stats {
+    uint32_t ticks;            // timer interrupts
+    uint32_t dinDropped;       // FIFO full at a tick
+    uint32_t bleDropped;       // BLE tick queue full / not connected
+    uint32_t taps, outliers;
+  };
+  const Stats& stats();
+  void printStats(Print& out = Serial);
+
+  // Beat length from taps. Header-only so the host simulation can drive it.
+  // Intervals outside 30..240 BPM restart the count (too long) or are
+  // ignored as switch chatter (too short). Once two intervals are in, one
+  // more than 25 % off their median is an outlier and dropped - unless the
+  // next interval agrees with it, which is taken as a new tempo. The beat is
+  // the mean of the last HISTORY accepted intervals.
+  struct TapTempo {
+    static constexpr uint8_t  HISTORY = 6;
+    static constexpr uint32_t MIN_US  = 250000;    // 240 BPM
+    static constexpr uint32_t MAX_US  = 2000000;   // 30 BPM
+
+    uint32_t iv[HISTORY] = {};
+    uint8_t  count = 0, next = 0;
+    uint32_t lastUs = 0;
+    bool     started = false;
+    uint32_t pending = 0;        // outlier waiting for a second one to agree
+    uint32_t taps = 0, outliers = 0;   // outliers: intervals dropped
+
+    // New beat length in us, or 0 when the tempo did not change
+    uint32_t tap(uint32_t nowUs) {
+      ++taps;
+      if (!started || nowUs - lastUs > MAX_US) { started = true; lastUs = nowUs; count = 0; pending = 0; return 0; }
+      const uint32_t d = nowUs - lastUs;
+      if (d < MIN_US) return 0;    // chatter / double hit: the earlier tap stands
+      lastUs = nowUs;
+      if (count >= 2) {
+        const uint32_t m = median();
+        if (offBy(d, m) > m / 4) {
+          if (pending && offBy(d, pending) <= pending / 4) {
+            --outliers;                  // the held one was a tempo change after all
+            count = 0; next = 0;
+            push(pending);
+            push(d);
+            pending = 0;
+            return mean();
+          }
+          ++outliers;
+          pending = d;
+          return 0;
+        }
+      }
+      pending = 0;
+      push(d);
+      return mean();
+    }
+
+  private:
+    static uint32_t offBy(uint32_t a, uint32_t b) { return a > b ? a - b : b - a; }
+    void push(uint32_t d) {
+      iv[next] = d;
+      next = (uint8_t)((next + 1) % HISTORY);
+      if (count < HISTORY) ++count;
+    }
+    uint32_t mean() const {
+      uint64_t sum = 0;
+      for (uint8_t i = 0; i < count; ++i) sum += iv[i];
+      return (uint32_t)(sum / count);
+    }
+    uint32_t median() const {
+      uint32_t s[HISTORY];
+      for (uint8_t i = 0; i < count; ++i) {
+        uint8_t j = i;
+        for (; j > 0 && s[j - 1] > iv[i]; --j) s[j] = s[j - 1];
+        s[j] = iv[i];
+      }
+      return count & 1 ? s[count / 2] : (s[count / 2 - 1] + s[count / 2]) / 2;
+    }
+  };
+}
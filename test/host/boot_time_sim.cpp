@@ -0,0 +1,78 @@
+// =============================
+// File: test/host/boot_time_sim.cpp — time to first frame / MIDI, old vs new setup()
+// =============================
+// Boots the firmware twice on the virtual clock, each in its own process:
+// the setup() from before boot_profile (a 200 ms settle, a mux scan and a
+// settings dump ahead of the panel) and today's deep_control_01.ino. Only
+// delay() and Serial's UART0 wire time (115200 baud) advance the clock; the
+// panel's init delays and SPI time are the same on both paths and are not
+// modelled, so the figures are the difference the boot path makes.
+#include <Arduino.h>
+#include <sys/mman.h>
+#include "host.h"
+#include "check.h"
+#include "../../deep_control_01.ino"
+
+namespace {
+  using boot_profile::Milestone;
+  constexpr uint8_t COUNT = (uint8_t)Milestone::Count;
+
+  // setup() and mode_manager::begin's extra begins as of the commit before
+  // boot_profile, on today's modules
+  void oldSetup() {
+    Serial.begin(115200);
+    delay(200);
+
+    settings_module::begin();
+    mux_module::begin();
+    mux_module::debug_scan_once();
+    settings_module::dumpToSerial();
+    display_module::earlyInit();
+    mirror_module::begin();
+    module_manager::begin_all();
+
+    settings_module::dumpToSerial();
+  }
+
+  struct Shared { int64_t at[2][COUNT]; };
+  Shared* sh = nullptr;
+
+  void boot(int path, void (*fn)()) {
+    inChild([&] {
+      std::string log;
+      host::serialLog = &log;
+      host::serialWireTime = true;
+      fn();
+      for (uint8_t m = 0; m < COUNT; ++m) sh->at[path][m] = boot_profile::atUs((Milestone)m);
+    });
+  }
+
+  void row(const char* name, Milestone m) {
+    const int64_t a = sh->at[0][(uint8_t)m], b = sh->at[1][(uint8_t)m];
+    printf("  %-16s %9.3f %9.3f\n", name, a / 1000.0, b / 1000.0);
+  }
+}
+
+int main() {
+  sh = (Shared*)mmap(nullptr, sizeof(Shared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  for (auto& p : sh->at) for (int64_t& t : p) t = -2;
+
+  boot(0, oldSetup);
+  boot(1, setup);
+
+  printf("[boot] virtual ms          old       new\n");
+  row("first frame",     Milestone::FirstFrame);
+  row("midi ready (DIN)", Milestone::MidiReady);
+  row("ble advertising", Milestone::BleAdvertising);
+
+  for (int p = 0; p < 2; ++p) {
+    CHECK(sh->at[p][(uint8_t)Milestone::FirstFrame] >= 0);
+    CHECK(sh->at[p][(uint8_t)Milestone::MidiReady] >= 0);
+    CHECK(sh->at[p][(uint8_t)Milestone::BleAdvertising] >= 0);
+  }
+  // The settle delay and the pre-frame scan + dump are gone from both
+  CHECK(sh->at[1][(uint8_t)Milestone::FirstFrame] + 200000 < sh->at[0][(uint8_t)Milestone::FirstFrame]);
+  CHECK(sh->at[1][(uint8_t)Milestone::MidiReady]  + 200000 < sh->at[0][(uint8_t)Milestone::MidiReady]);
+
+  return checkResult("boot_time_sim");
+}
@@ -0,0 +1,67 @@
+// =============================
+// File: test/host/brightness_idle_test.cpp — play-mode dim / off timing
+// =============================
+#include <Arduino.h>
+#include "host.h"
+#include "check.h"
+#include "settings_module.h"
+#include "display_module.h"
+#include "mode_manager.h"
+#include "brightness_module.h"
+#include "fader_module.h"
+#include "pinmap_module.h"
+
+namespace {
+  // Run update() once per ms of virtual time
+  void idle(uint32_t ms) {
+    while (ms--) { delay(1); brightness_module::update(); }
+  }
+}
+
+int main() {
+  settings_module::begin();
+  display_module::earlyInit();
+  mode_manager::begin();
+  mode_manager::setSetupMode(false);   // the idle policy only runs in play
+
+  // Boot and instant writes never stop a fade that was not started
+  brightness_module::setLevel(brightness_module::Channel::Leds, 7);
+  CHECK_EQ(host::ledcFadeStopErrors, 0);
+
+  // A shorter off time clamps when dimming starts...
+  brightness_module::setIdleTimeouts(5000, 2000);
+  CHECK_EQ(brightness_module::dimAfterMs(), 5000);
+  brightness_module::noteActivity();
+  idle(1999);
+  CHECK(!brightness_module::isDimmed());
+  idle(1);
+  CHECK(brightness_module::isDimmed());
+
+  // ...but does not overwrite the dim setting: raising the off time
+  // (as `sleep <sec>` does) brings the configured dim time back
+  brightness_module::setIdleTimeouts(brightness_module::dimAfterMs(), 8000);
+  brightness_module::noteActivity();
+  idle(4999);
+  CHECK(!brightness_module::isDimmed());
+  idle(2);
+  CHECK(brightness_module::isDimmed());
+  idle(3000);
+  CHECK(brightness_module::isOff());
+  CHECK_EQ(host::ledcFadeStopErrors, 0);
+
+  // A fader move is input too: the backlight comes back at once
+  host::adc[pinmap::FADER1_PIN] = 1000;
+  fader_module::begin();
+  fader_module::update();
+  CHECK(brightness_module::isOff());
+  host::adc[pinmap::FADER1_PIN] = 3000;
+  for (int i = 0; i < 10 && brightness_module::isOff(); ++i) fader_module::update();
+  CHECK(!brightness_module::isOff() && !brightness_module::isDimmed());
+
+  // Setup is always lit
+  mode_manager::setSetupMode(true);
+  idle(20000);
+  CHECK(!brightness_module::isDimmed() && !brightness_module::isOff());
+
+  return checkResult("brightness_idle_test");
+}
@@ -0,0 +1,38 @@
+// =============================
+// File: test/host/check.h — minimal assertions for the host tests
+// =============================
+#pragma once
+#include <stdio.h>
+
+static int g_checkFailures = 0;
+
+// Reports and counts; the test keeps going so one run shows every failure
+#define CHECK(cond) do { \
+    if (!(cond)) { fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); ++g_checkFailures; } \
+  } while (0)
+
+#define CHECK_EQ(a, b) do { \
+    const long long a_ = (long long)(a), b_ = (long long)(b); \
+    if (a_ != b_) { fprintf(stderr, "%s:%d: CHECK_EQ(%s, %s) failed: %lld != %lld\n", __FILE__, __LINE__, #a, #b, a_, b_); ++g_checkFailures; } \
+  } while (0)
+
+inline int checkResult(const char* name) {
+  if (g_checkFailures) fprintf(stderr, "%s: %d check(s) failed\n", name, g_checkFailures);
+  else printf("%s: ok\n", name);
+  return g_checkFailures ? 1 : 0;
+}
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+// Runs fn in a forked child, for code with run-once state such as a boot.
+// The child's failed checks are added to this process's count.
+template <typename Fn> void inChild(Fn fn) {
+  fflush(stdout);
+  const pid_t pid = fork();
+  if (pid == 0) { g_checkFailures = 0; fn(); fflush(stdout); _exit(g_checkFailures > 255 ? 255 : g_checkFailures); }
+  int status = 0;
+  waitpid(pid, &status, 0);
+  if (!WIFEXITED(status)) { fprintf(stderr, "child did not exit cleanly\n"); ++g_checkFailures; }
+  else g_checkFailures += WEXITSTATUS(status);
+}
@@ -0,0 +1,43 @@
+// =============================
+// File: test/host/fader_pickup_test.cpp — soft takeover across locations
+// =============================
+#include <Arduino.h>
+#include "host.h"
+#include "check.h"
+#include "pinmap_module.h"
+#include "settings_module.h"
+#include "program_change.h"
+#include "fader_module.h"
+
+namespace {
+  // Let the smoothing settle on the new reading
+  void moveTo(int adc) {
+    host::adc[pinmap::FADER1_PIN] = adc;
+    for (int i = 0; i < 40; ++i) { fader_module::update(); host::advanceUs(2000); }
+  }
+
+  void go(uint16_t preset) {
+    program_change::select(preset);
+    fader_module::update();
+  }
+}
+
+int main() {
+  settings_module::begin();
+  host::adc[pinmap::FADER1_PIN] = 2000;
+  fader_module::begin();
+
+  go(0);                  // A: fader 1 sends from the top
+  moveTo(4000);
+  go(1);                  // B: left alone, so nothing is known there
+  go(2);                  // C: fader 1 sends from the bottom
+  moveTo(0);
+
+  go(1);                  // back to B: live, not held at A's position
+  CHECK_EQ(fader_module::pickup(0), 0);
+
+  go(0);                  // back to A: held until it comes up to the top
+  CHECK_EQ(fader_module::pickup(0), 1);
+
+  return checkResult("fader_pickup_test");
+}
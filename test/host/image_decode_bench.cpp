@@ -0,0 +1,68 @@
+// =============================
+// File: test/host/image_decode_bench.cpp — RLE565 decode throughput
+// =============================
+// Decodes the splash and every icon into a summing sink and prints Mpx/s
+// (host CPU, run.sh's -O1), then checks that every asset decodes whole and
+// that a stream cut short makes blit() fail.
+#include <Arduino.h>
+#include <chrono>
+#include "host.h"
+#include "check.h"
+#include "settings_module.h"
+#include "display_module.h"
+#include "image_module.h"
+#include "layout_constants.h"
+#include "images/splash.h"
+#include "images/icons.h"
+
+namespace {
+  struct Asset { const char* name; const image_module::Image* img; };
+  const Asset ASSETS[] = {
+    { "SPLASH",        &images::SPLASH },
+    { "ICON_BLE",      &images::ICON_BLE },
+    { "ICON_DIN",      &images::ICON_DIN },
+    { "ICON_BATTERY",  &images::ICON_BATTERY },
+    { "ICON_CHARGING", &images::ICON_CHARGING },
+  };
+
+  // Keeps the decode from being optimised away
+  void sum(uint16_t* px, uint16_t n, void* ctx) {
+    uint32_t& s = *static_cast<uint32_t*>(ctx);
+    for (uint16_t i = 0; i < n; ++i) s += px[i];
+  }
+
+  uint16_t s_buf[SCREEN_W];
+}
+
+int main() {
+  settings_module::begin();
+  display_module::earlyInit();
+
+  printf("[image] decode into a %u-pixel line buffer\n", (unsigned)SCREEN_W);
+  for (const Asset& a : ASSETS) {
+    const image_module::Image& img = *a.img;
+    const uint32_t px = (uint32_t)img.w * img.h;
+    uint32_t check = 0;
+    CHECK_EQ(image_module::decode(img, s_buf, SCREEN_W, sum, &check), px);
+
+    const uint32_t reps = 2000000 / px + 1;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t r = 0; r < reps; ++r) image_module::decode(img, s_buf, SCREEN_W, sum, &check);
+    const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    printf("  %-14s %3ux%-3u %5u B (raw %6u)  %7.2f us/decode  %6.1f Mpx/s  (sum %08x)\n",
+           a.name, img.w, img.h, (unsigned)img.size, (unsigned)(px * 2), us / reps, px * reps / us, (unsigned)check);
+
+    CHECK(image_module::blit(img, 0, 0));
+  }
+
+  // A stream cut short anywhere draws what it can and reports failure
+  for (uint32_t cut : { 1u, 2u, images::SPLASH.size / 2, images::SPLASH.size - 1 }) {
+    image_module::Image t = images::SPLASH;
+    t.size = cut;
+    uint32_t check = 0;
+    CHECK(image_module::decode(t, s_buf, SCREEN_W, sum, &check) < (uint32_t)t.w * t.h);
+    CHECK(!image_module::blit(t, 0, 0));
+  }
+
+  return checkResult("image_decode_bench");
+}
@@ -0,0 +1,103 @@
+// =============================
+// File: test/host/midi_clock_sim.cpp — MIDI clock jitter under fader load
+// =============================
+// Prints what "tempo sim" prints (midi_wire_sim::clock), then runs the same
+// load through the firmware itself: tempo_module's alarm callback fired at
+// each tick, faders swept through fader_module -> midi_out -> midi_din, and
+// each clock byte timed to when it leaves the modelled UART.
+#include <Arduino.h>
+#include <math.h>
+#include <esp_intr_alloc.h>
+#include "host.h"
+#include "check.h"
+#include "pinmap_module.h"
+#include "settings_module.h"
+#include "midi_din.h"
+#include "midi_out.h"
+#include "fader_module.h"
+#include "tempo_module.h"
+#include "midi_wire_sim.h"
+
+namespace {
+  struct Stdout : Print {
+    size_t write(uint8_t c) override { putchar(c); return 1; }
+    using Print::write;
+  };
+
+  // Loop timing as in midi_wire_sim: 0.7-1.3 ms passes, a 20 ms redraw in
+  // about one pass in 40
+  constexpr uint32_t RUN_MS = 4000;
+  constexpr uint8_t  FADER_PINS[4] = { pinmap::FADER1_PIN, pinmap::FADER2_PIN, pinmap::FADER3_PIN, pinmap::FADER4_PIN };
+
+  inline uint32_t lcg(uint32_t& s) { s = s * 1664525UL + 1013904223UL; return s >> 8; }
+
+  // 100 ms up-and-down sweeps, a quarter period apart
+  int sweep(uint8_t f, uint64_t us) {
+    const uint32_t t = (uint32_t)((us / 1000 + f * 25) % 100);
+    return (int)(t < 50 ? t * 4095 / 50 : (100 - t) * 4095 / 50);
+  }
+}
+
+int main() {
+  Stdout out;
+  midi_wire_sim::clock(out);
+
+  settings_module::begin();
+  midi_din::begin();
+  fader_module::begin();
+  tempo_module::begin();
+
+  // The UART and the clock timer share one interrupt level
+  CHECK_EQ(host::uartIntrFlags, ESP_INTR_FLAG_LEVEL1);
+  CHECK_EQ(host::timer.intrPriority, midi_din::ISR_LEVEL);
+
+  tempo_module::setBpm(120.0f);
+  const uint32_t tickUs = (500000 + tempo_module::PPQN / 2) / tempo_module::PPQN;
+  CHECK(host::timer.running);
+  CHECK_EQ(host::timer.alarm, tickUs);
+
+  uint32_t seed = 12345, intervals = 0, devMax = 0;
+  double devSum = 0, devSq = 0;
+  uint64_t nextTick = tickUs, prevDone = 0;
+  bool havePrev = false;
+  while (host::nowUs() < RUN_MS * 1000ULL) {
+    uint64_t passEnd = host::nowUs() + 700 + lcg(seed) % 600;
+    if (lcg(seed) % 40 == 0) passEnd += 20000;
+
+    for (uint8_t f = 0; f < 4; ++f) host::adc[FADER_PINS[f]] = sweep(f, host::nowUs());
+    fader_module::update();
+    midi_out::update();
+    midi_din::update();
+
+    for (; nextTick <= passEnd; nextTick += tickUs) {
+      host::advanceUs(nextTick - host::nowUs());
+      host::timer.fire();
+      const uint64_t done = host::uartIdleAtUs();
+      if (havePrev) {
+        const uint32_t iv  = (uint32_t)(done - prevDone);
+        const uint32_t dev = iv > tickUs ? iv - tickUs : tickUs - iv;
+        ++intervals;
+        devSum += dev;
+        devSq += (double)dev * dev;
+        if (dev > devMax) devMax = dev;
+      }
+      prevDone = done;
+      havePrev = true;
+    }
+    host::advanceUs(passEnd - host::nowUs());
+  }
+
+  const midi_out::Stats& ms = midi_out::stats();
+  printf("  firmware, host UART   intervals=%u jitter avg/max/sd=%.0f/%u/%.0f us, fader msgs=%u, din_drop=%u\n",
+         (unsigned)intervals, devSum / intervals, (unsigned)devMax, sqrt(devSq / intervals),
+         (unsigned)ms.sent[midi_out::SINK_DIN][(uint8_t)midi_out::Priority::Fader],
+         (unsigned)tempo_module::stats().dinDropped);
+
+  // A clock byte waits behind at most the fader budget plus the byte on the wire
+  CHECK(intervals > 150);
+  CHECK(ms.sent[midi_out::SINK_DIN][(uint8_t)midi_out::Priority::Fader] > 1000);
+  CHECK_EQ(tempo_module::stats().dinDropped, 0);
+  CHECK(devMax <= (midi_out::DIN_BUDGET_BYTES + 1) * midi_din::BYTE_US);
+
+  return checkResult("midi_clock_sim");
+}
@@ -0,0 +1,43 @@
+// =============================
+// File: test/host/midi_din_budget_test.cpp — fader bytes held to the DIN budget
+// =============================
+#include <Arduino.h>
+#include "host.h"
+#include "check.h"
+#include "settings_module.h"
+#include "midi_din.h"
+#include "midi_out.h"
+
+int main() {
+  settings_module::begin();
+  midi_din::begin();
+
+  // A sweep over ten faders at one instant. The driver hands everything to
+  // the TX FIFO at once; the budget still has to see those bytes.
+  for (uint8_t cc = 20; cc < 30; ++cc) midi_out::controlChange(cc, 64);
+  CHECK_EQ(midi_din::backlog(), 0);
+  CHECK(midi_din::inFlight() <= midi_out::DIN_BUDGET_BYTES);
+  CHECK(host::uartQueued() <= midi_out::DIN_BUDGET_BYTES);
+  CHECK(host::uartWritten() < 10 * 2);
+
+  // A program change is not held back by the budget
+  const uint32_t before = host::uartWritten();
+  midi_out::programChange(5);
+  CHECK_EQ(host::uartWritten(), before + 2);
+
+  // Once that is out, the rest follow as the wire drains, never more than
+  // the budget ahead
+  host::advanceUs(10 * midi_din::BYTE_US);
+  CHECK_EQ(midi_din::inFlight(), 0);
+  uint32_t maxQueued = 0;
+  for (int i = 0; i < 200; ++i) {
+    host::advanceUs(100);
+    midi_out::update();
+    if (host::uartQueued() > maxQueued) maxQueued = host::uartQueued();
+  }
+  CHECK(maxQueued <= midi_out::DIN_BUDGET_BYTES);
+  CHECK_EQ(midi_out::stats().sent[midi_out::SINK_DIN][(uint8_t)midi_out::Priority::Fader], 10);
+  CHECK_EQ(midi_din::inFlight(), 0);
+
+  return checkResult("midi_din_budget_test");
+}
@@ -0,0 +1,83 @@
+// =============================
+// File: test/host/render_cost_table.cpp — per-screen render cost on the host
+// =============================
+// Prints the same table as the `prof` console command, from the real screen
+// code drawn through the host GFX model, and checks that the walk hands the
+// display back to the mode it started in.
+#include <Arduino.h>
+#include "host.h"
+#include "check.h"
+#include "settings_module.h"
+#include "display_module.h"
+#include "mode_manager.h"
+#include "setup_module.h"
+#include "midi_monitor.h"
+#include "render_profiler.h"
+#include "screen_profile.h"
+
+namespace {
+  // Cost of one action, as a table row
+  template <typename Fn> render_profiler::Stats profile(const char* label, Fn fn) {
+    render_profiler::Stats s;
+    render_profiler::begin(true);
+    fn();
+    render_profiler::end(s);
+    render_profiler::printTableRow(Serial, label, s);
+    return s;
+  }
+
+  uint32_t windows(const render_profiler::Stats& s) { return s.windows; }
+
+  // od_px (6th number after the 32-column label) of every row of a walk:
+  // the steps' sum and the TOTAL row's value
+  void overdrawColumn(const std::string& log, unsigned long& steps, unsigned long& total) {
+    steps = total = 0;
+    size_t at = 0;
+    while (at < log.size()) {
+      size_t eol = log.find('\n', at);
+      if (eol == std::string::npos) eol = log.size();
+      const std::string row = log.substr(at, eol - at);
+      at = eol + 1;
+      unsigned long v[6];
+      if (row.size() < 33 || sscanf(row.c_str() + 32, "%lu %lu %lu %lu %lu %lu", &v[0], &v[1], &v[2], &v[3], &v[4], &v[5]) != 6) continue;
+      (row.compare(0, 5, "TOTAL") == 0 ? total : steps) += v[5];
+    }
+  }
+}
+
+int main() {
+  host::serialEcho = false;
+  settings_module::begin();
+  display_module::earlyInit();
+  mode_manager::begin();
+  host::serialEcho = true;
+
+  printf("-- setup walk (started in setup)\n");
+  std::string walk;
+  host::serialLog = &walk;
+  screen_profile::run(Serial);
+  host::serialLog = nullptr;
+  CHECK(mode_manager::inSetupMode());
+  unsigned long odSteps, odTotal;
+  overdrawColumn(walk, odSteps, odTotal);
+  CHECK(odSteps > 0);
+  CHECK_EQ(odTotal, odSteps);
+
+  printf("-- play mode and overlays\n");
+  render_profiler::printTableHeader(Serial);
+  profile("enter play", [] { mode_manager::setSetupMode(false); });
+  profile("MIDI monitor show", [] { midi_monitor::show(); });
+  profile("MIDI monitor hide", [] { midi_monitor::hide(); mode_manager::redraw(); });
+  profile("enter setup", [] { mode_manager::setSetupMode(true); });
+  profile("leave setup", [] { mode_manager::setSetupMode(false); });
+
+  printf("-- setup walk (started in play)\n");
+  screen_profile::run(Serial);
+  host::serialEcho = false;
+  CHECK(!mode_manager::inSetupMode());
+  // Back in play: the setup screens no longer react to the encoder
+  const render_profiler::Stats quiet = profile("turn in play", [] { setup_module::onEncoderTurn(+1); });
+  CHECK_EQ(windows(quiet), 0);
+
+  return checkResult("render_cost_table");
+}
@@ -0,0 +1,40 @@
+#!/bin/bash
+# Host tests: the firmware sources built against the stand-ins in stubs/.
+#   test/host/run.sh            build and run every test in this directory
+#   test/host/run.sh <name>...  only these (file name without .cpp)
+# A test whose first line is "// host-flags: ..." gets its own build of the
+# sources with those flags (e.g. a different settings backend).
+set -e
+cd "$(dirname "$0")"
+CXX=${CXX:-g++}
+BASE="-std=gnu++17 -O1 -g -Wall -Wno-unused-function -Istubs -I../.. -I../../src"
+mkdir -p build
+
+# objs <dir> <flags>: compile stubs + src into build/<dir>, print the object list
+objs() {
+  local dir=build/$1; shift
+  mkdir -p "$dir"
+  for f in stubs/*.cpp ../../src/*.cpp; do
+    echo "$CXX $BASE $* -c $f -o $dir/$(basename "${f%.cpp}").o"
+  done | xargs -P"$(nproc)" -I{} sh -c '{}' >&2
+  for f in stubs/*.cpp ../../src/*.cpp; do echo "$dir/$(basename "${f%.cpp}").o"; done
+}
+
+tests=("$@")
+[ ${#tests[@]} -eq 0 ] && for f in *.cpp; do tests+=("${f%.cpp}"); done
+
+default_objs=""
+fail=0
+for t in "${tests[@]}"; do
+  flags=$(sed -n '1s#^// host-flags: *##p' "$t.cpp")
+  if [ -n "$flags" ]; then
+    o=$(objs "obj-$t" $flags)
+  else
+    [ -z "$default_objs" ] && default_objs=$(objs obj)
+    o=$default_objs
+  fi
+  $CXX $BASE $flags "$t.cpp" $o -o "build/$t"
+  echo "== $t"
+  if ! "./build/$t"; then echo "FAILED: $t"; fail=1; fi
+done
+exit $fail
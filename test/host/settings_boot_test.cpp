@@ -0,0 +1,110 @@
+// host-flags: -DSETTINGS_DEBUG
+// =============================
+// File: test/host/settings_boot_test.cpp — NVS cost of a boot, migration steps
+// =============================
+// Each boot runs in its own process against one NVS file, like a power
+// cycle. The stand-in Preferences counts every read and write itself, so
+// the firmware's own bootNvsReads()/bootNvsWrites() are checked against it.
+#include <Arduino.h>
+#include <Preferences.h>
+#include <string>
+#include "host.h"
+#include "check.h"
+#include "settings_module.h"
+
+namespace {
+  const char* NVS_FILE = "build/settings_boot_test.nvs";
+
+  size_t count(const std::string& s, const std::string& what) {
+    size_t n = 0;
+    for (size_t at = s.find(what); at != std::string::npos; at = s.find(what, at + 1)) ++n;
+    return n;
+  }
+
+  // Boot in a child; check() runs there after settings_module::begin()
+  template <typename Fn> void boot(Fn check) {
+    inChild([&] {
+      std::string log;
+      host::serialLog = &log;
+      host::nvs.load();
+      host::nvs.resetCounters();
+      settings_module::begin();
+      host::serialLog = nullptr;
+      check(log);
+    });
+    host::nvs.load();
+  }
+
+  // Every step from 0 -> 1 up to the current schema, once each
+  void checkFullMigration(const std::string& log) {
+    CHECK_EQ(count(log, "[settings_module] migrate "), 6);
+    for (int v = 0; v < 6; ++v) {
+      char step[48]; snprintf(step, sizeof(step), "[settings_module] migrate %d->%d:", v, v + 1);
+      CHECK_EQ(count(log, step), 1);
+    }
+  }
+
+  // A normal boot: the blob (length + bytes), each label pool (map length,
+  // map bytes when present, one string per label) and the staged import's
+  // length; nothing written
+  void checkNormalBoot(const std::string& log, uint32_t faderLabels, uint32_t stompLabels) {
+    const uint32_t pool = 1;   // map length only when the pool was never written
+    const uint32_t expectReads = 2 + (faderLabels ? 2 + faderLabels : pool) + (stompLabels ? 2 + stompLabels : pool) + 1;
+    CHECK_EQ(count(log, "[settings_module] migrate "), 0);
+    CHECK_EQ(settings_module::bootNvsReads(), expectReads);
+    CHECK_EQ(settings_module::bootNvsWrites(), 0);
+    CHECK_EQ(host::nvs.reads, expectReads);
+    CHECK_EQ(host::nvs.writes + host::nvs.removes, 0);
+  }
+}
+
+int main() {
+  host::nvs.file = NVS_FILE;
+
+  // ---- Factory boot: empty NVS runs every migration once
+  remove(NVS_FILE);
+  boot([](const std::string& log) {
+    checkFullMigration(log);
+    CHECK(settings_module::bootNvsWrites() > 0);
+    CHECK_EQ(settings_module::getFaderCC(0), 20);
+  });
+  boot([](const std::string& log) { checkNormalBoot(log, 0, 0); });
+
+  // ---- v2.x keys: migrated once, old keys gone afterwards
+  remove(NVS_FILE);
+  host::nvs.store.clear();
+  {
+    Preferences p;
+    p.begin("setup", false);
+    p.putUChar("ble_ch", 3);
+    p.putUChar("f_cc_0", 30);
+    p.putUChar("s_cc_1", 90);
+    p.putFloat("mirror_ms", 500.0f);
+    p.putUChar("f_lbl_n", 2);
+    p.putString("f_lbl_0", "Gain");
+    p.putString("f_lbl_1", "Delay");
+    p.end();
+  }
+  boot([](const std::string& log) {
+    checkFullMigration(log);
+    CHECK_EQ(settings_module::getBleMidiChannel(), 3);
+    CHECK_EQ(settings_module::getFaderCC(0), 30);
+    CHECK_EQ(settings_module::getFaderCC(1), 21);
+    CHECK_EQ(settings_module::getStompCC(1), 90);
+    CHECK_EQ(settings_module::getStompCC(0), 80);
+    CHECK_EQ(settings_module::getCustomFaderLabelCount(), 2);
+    CHECK(!strcmp(settings_module::getCustomFaderLabel(1), "Delay"));
+  });
+  CHECK(host::nvs.store.count("f_lbl_n") == 0);
+  CHECK(host::nvs.store.count("f_lbl_0") == 0);
+  CHECK(host::nvs.store.count("ble_ch") == 0);
+  CHECK(host::nvs.store.count("f_cc_0") == 0);
+
+  boot([](const std::string& log) {
+    checkNormalBoot(log, 2, 0);
+    CHECK_EQ(settings_module::getFaderCC(0), 30);
+    CHECK(!strcmp(settings_module::getCustomFaderLabel(0), "Gain"));
+  });
+
+  return checkResult("settings_boot_test");
+}
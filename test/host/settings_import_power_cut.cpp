@@ -0,0 +1,123 @@
+// =============================
+// File: test/host/settings_import_power_cut.cpp — power cuts during a cfg import
+// =============================
+// An import replaces the settings blob and both custom label pools. For every
+// NVS write K of one import, the import is replayed with the power cut at
+// write K; the next boot must see the old settings and labels or the new ones,
+// never the new settings over the old labels (or the other way round).
+#include <Arduino.h>
+#include <sys/mman.h>
+#include "host.h"
+#include "check.h"
+#include "settings_module.h"
+
+namespace {
+  using settings_module::BUILTIN_FADER_LABELS;
+
+  struct Snap {
+    uint8_t ble, faderLabel, nf, ns;
+    char    fader[3][settings_module::LABEL_MAX_LEN + 1];
+    char    stomp[settings_module::LABEL_MAX_LEN + 1];
+    bool operator==(const Snap& o) const { return !memcmp(this, &o, sizeof(Snap)); }
+  };
+
+  Snap snap() {
+    Snap s = {};
+    s.ble        = settings_module::getBleMidiChannel();
+    s.faderLabel = settings_module::getFaderLabelIndex(0);
+    s.nf         = settings_module::getCustomFaderLabelCount();
+    s.ns         = settings_module::getCustomStompLabelCount();
+    for (uint8_t i = 0; i < 3; ++i) strcpy(s.fader[i], settings_module::getCustomFaderLabel(i));
+    strcpy(s.stomp, settings_module::getCustomStompLabel(0));
+    return s;
+  }
+
+  const char* const OLD_FADER[] = { "Old 1", "Old 2" };
+  const char* const OLD_STOMP[] = { "Old S" };
+  const char* const NEW_FADER[] = { "New 1", "New 2", "New 3" };
+
+  // Written by the children, read by the parent
+  struct Shared {
+    uint8_t  image[settings_module::IMAGE_MAX_BYTES];
+    size_t   len;
+    Snap     before, after, booted;
+    uint32_t writes;
+  };
+  Shared* sh = nullptr;
+
+  const char* NVS_FILE  = "build/import_cut.nvs";
+  const char* BASE_FILE = "build/import_cut.base";
+
+  void copyFile(const char* from, const char* to) {
+    FILE* a = fopen(from, "rb"); FILE* b = fopen(to, "wb");
+    char buf[4096]; size_t n;
+    while (a && b && (n = fread(buf, 1, sizeof(buf), a)) > 0) fwrite(buf, 1, n, b);
+    if (a) fclose(a);
+    if (b) fclose(b);
+  }
+
+  template <typename Fn> void power(Fn fn) {
+    inChild([&] {
+      host::nvs.file = NVS_FILE;
+      host::nvs.load();
+      settings_module::begin();
+      fn();
+    });
+  }
+
+  // One power cycle: import with the power cut at write cutAt (-1: no cut)
+  void importCut(long cutAt) {
+    power([&] {
+      host::nvs.resetCounters();
+      host::nvs.cutAt = cutAt;
+      CHECK(settings_module::importImage(sh->image, sh->len, NEW_FADER, 3, nullptr, 0));
+      sh->writes = host::nvs.writes + host::nvs.removes;
+    });
+  }
+}
+
+int main() {
+  sh = (Shared*)mmap(nullptr, sizeof(Shared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+  // The image points fader 0 at the third custom label, which only the new
+  // list has; the unit it lands on has two other labels and a stomp label.
+  remove(NVS_FILE);
+  power([] {
+    settings_module::setBleMidiChannel(9);
+    settings_module::setFaderLabelIndex(0, BUILTIN_FADER_LABELS + 2);
+    sh->len = settings_module::exportImage(sh->image, sizeof(sh->image));
+    settings_module::setBleMidiChannel(3);
+    settings_module::setFaderLabelIndex(0, BUILTIN_FADER_LABELS + 1);
+    settings_module::replaceCustomFaderLabels(OLD_FADER, 2);
+    settings_module::replaceCustomStompLabels(OLD_STOMP, 1);
+    settings_module::flushNow();
+    sh->before = snap();
+  });
+  copyFile(NVS_FILE, BASE_FILE);
+
+  importCut(-1);
+  power([] { sh->after = snap(); });
+  const Snap before = sh->before, after = sh->after;
+  const uint32_t writes = sh->writes;
+  CHECK_EQ(after.ble, 9);
+  CHECK_EQ(after.faderLabel, BUILTIN_FADER_LABELS + 2);
+  CHECK_EQ(after.nf, 3);
+  CHECK_EQ(after.ns, 1);             // no stomp list given: kept
+  CHECK(!strcmp(after.fader[2], "New 3"));
+
+  int olds = 0, news = 0, bad = 0;
+  for (long k = 0; k <= (long)writes; ++k) {
+    copyFile(BASE_FILE, NVS_FILE);
+    importCut(k);
+    power([] { sh->booted = snap(); });
+    if (sh->booted == before) ++olds;
+    else if (sh->booted == after) ++news;
+    else if (++bad <= 5) fprintf(stderr, "settings_import_power_cut: cut at write %ld boots a mix\n", k);
+  }
+  printf("settings_import_power_cut: %u writes per import; cuts: %d old, %d new, %d mixed\n",
+         (unsigned)writes, olds, news, bad);
+  CHECK_EQ(bad, 0);
+  CHECK(olds > 0 && news > 0);
+
+  return checkResult("settings_import_power_cut");
+}
@@ -0,0 +1,79 @@
+// =============================
+// File: test/host/settings_label_pool_test.cpp — label map validation, write stats
+// =============================
+#include <Arduino.h>
+#include <Preferences.h>
+#include "host.h"
+#include "check.h"
+#include "settings_module.h"
+
+namespace {
+  // Stored layout of settings_module's LabelMap
+  struct LabelMap {
+    uint16_t used;
+    uint8_t  count;
+    uint8_t  order[settings_module::MAX_CUSTOM_LABELS];
+  };
+
+  // Boots on a factory image whose fader label map is `m`, slots 0..15 filled
+  void bootWithMap(const LabelMap& m, uint8_t expectCount) {
+    inChild([&] {
+      Preferences p;
+      p.begin("setup", false);
+      for (uint8_t id = 0; id < settings_module::MAX_CUSTOM_LABELS; ++id) {
+        char k[8], t[8]; snprintf(k, sizeof(k), "cf_%u", id); snprintf(t, sizeof(t), "L%u", id);
+        p.putString(k, t);
+      }
+      p.putBytes("cf_map", &m, sizeof(m));
+      host::nvs.resetCounters();
+      settings_module::begin();
+      CHECK_EQ(settings_module::getCustomFaderLabelCount(), expectCount);
+      CHECK_EQ(host::nvs.writes + host::nvs.removes, 0);
+      // A reset pool hands out slot 0 again
+      if (expectCount == 0) {
+        CHECK(settings_module::addCustomFaderLabel("New"));
+        CHECK(!strcmp(settings_module::getCustomFaderLabel(0), "New"));
+      }
+    });
+  }
+}
+
+int main() {
+  // Factory image (blob written, v2 keys cleaned up) that every child starts from
+  host::nvs.file = "build/settings_label_pool_test.nvs";
+  remove(host::nvs.file);
+  inChild([] { settings_module::begin(); });
+  host::nvs.load();
+  host::nvs.file = nullptr;
+
+  // ---- writesSaved() never wraps: pool edits count as their own calls
+  inChild([] {
+    settings_module::begin();
+    for (int i = 0; i < 10; ++i) settings_module::addCustomFaderLabel("X");
+    settings_module::deleteCustomFaderLabel(0);
+    settings_module::updateCustomFaderLabel(0, "Y");
+    CHECK_EQ(settings_module::writesSaved(), 0);
+    settings_module::setFaderCC(0, 40);
+    settings_module::setFaderCC(0, 41);
+    settings_module::setFaderCC(0, 42);
+    settings_module::flushNow();
+    CHECK_EQ(settings_module::writesSaved(), 2);   // 3 setter calls, 1 blob write
+  });
+
+  // ---- label maps
+  const LabelMap good = { 0x0005, 2, { 2, 0 } };
+  bootWithMap(good, 2);
+
+  LabelMap bad = good; bad.count = 17;              // count out of range
+  bootWithMap(bad, 0);
+  bad = good; bad.order[1] = 16;                    // id out of range
+  bootWithMap(bad, 0);
+  bad = good; bad.order[1] = 2;                     // id listed twice
+  bootWithMap(bad, 0);
+  bad = good; bad.used = 0x0007;                    // used bit without an entry
+  bootWithMap(bad, 0);
+  bad = good; bad.used = 0x0004;                    // entry without its used bit
+  bootWithMap(bad, 0);
+
+  return checkResult("settings_label_pool_test");
+}
@@ -0,0 +1,40 @@
+// =============================
+// File: test/host/settings_notify_test.cpp — change notification order
+// =============================
+#include <Arduino.h>
+#include "host.h"
+#include "check.h"
+#include "settings_module.h"
+
+namespace {
+  using settings_module::Field;
+
+  uint8_t s_ccSeen = 0, s_calls = 0;
+
+  // A PresetMode subscriber must already see the new mode's CCs
+  void onMode(Field f, uint8_t) {
+    if (f != Field::PresetMode) return;
+    ++s_calls;
+    s_ccSeen = settings_module::getFaderCC(0);
+  }
+}
+
+int main() {
+  settings_module::begin();
+  settings_module::subscribe(settings_module::maskOf(Field::PresetMode), onMode);
+  const uint16_t gen = settings_module::generation(Field::PresetMode);
+
+  settings_module::setPresetMode(3);   // Kemper: fader 1 = CC 72
+  CHECK_EQ(s_calls, 1);
+  CHECK_EQ(s_ccSeen, 72);
+  CHECK_EQ(settings_module::generation(Field::PresetMode), (uint16_t)(gen + 1));
+
+  settings_module::setPresetMode(0);
+  CHECK_EQ(s_calls, 2);
+  CHECK_EQ(s_ccSeen, 20);
+
+  settings_module::setPresetMode(0);   // no change, no notification
+  CHECK_EQ(s_calls, 2);
+
+  return checkResult("settings_notify_test");
+}
@@ -0,0 +1,140 @@
+// =============================
+// File: test/host/settings_power_cut.h — power-cut fuzz + write cost, any backend
+// =============================
+// Shared by settings_power_cut_blob.cpp and settings_power_cut_journal.cpp,
+// which build the sources with SETTINGS_BACKEND_JOURNAL = 0 / 1.
+//
+// A reference run makes EDITS random edits, each committed with flushNow(),
+// and records the settings after every commit. Then, for every NVS write
+// K of that run, the same edits are replayed with the power cut at write K
+// and the next boot must see either the last committed settings or the
+// edit that was being committed - never a mix or garbage.
+#pragma once
+#include <Arduino.h>
+#include <sys/mman.h>
+#include "host.h"
+#include "check.h"
+#include "settings_module.h"
+
+namespace power_cut {
+  constexpr int SEEDS = 5;
+  constexpr int EDITS = 90;
+
+  struct Snap {
+    uint8_t v[11];
+    bool operator==(const Snap& o) const { return !memcmp(v, o.v, sizeof(v)); }
+  };
+
+  Snap snap() {
+    Snap s;
+    for (uint8_t i = 0; i < 4; ++i) { s.v[i] = settings_module::getFaderCC(i); s.v[4 + i] = settings_module::getStompCC(i); }
+    s.v[8]  = settings_module::getPresetMode();
+    s.v[9]  = settings_module::getLedBrightness();
+    s.v[10] = settings_module::getAxeModel();
+    return s;
+  }
+
+  void edit() {
+    const uint8_t k = (uint8_t)(rand() % 4), v = (uint8_t)(rand() % 128);
+    switch (rand() % 5) {
+      case 0:  settings_module::setFaderCC(k, v); break;
+      case 1:  settings_module::setStompCC(k, v); break;
+      case 2:  settings_module::setPresetMode(v % settings_module::PRESET_MODE_COUNT); break;
+      case 3:  settings_module::setAxeModel(v & 1); break;
+      default: settings_module::setLedBrightness(v % 21); break;
+    }
+  }
+
+  // Written by the children, read by the parent
+  struct Shared {
+    int      done;              // edits committed before the cut
+    Snap     pending;           // the edit being committed
+    Snap     after[EDITS + 1];  // [0] = boot state, [k] = after edit k
+    Snap     booted;            // what the boot after the cut loaded
+    uint32_t writes, nvsWrites, nvsBytes, setterCalls;
+    uint64_t hostBytes;
+  };
+  Shared* sh = nullptr;
+
+  const char* NVS_FILE  = "build/power_cut.nvs";
+  const char* BASE_FILE = "build/power_cut.base";
+
+  void copyFile(const char* from, const char* to) {
+    FILE* a = fopen(from, "rb"); FILE* b = fopen(to, "wb");
+    char buf[4096]; size_t n;
+    while (a && b && (n = fread(buf, 1, sizeof(buf), a)) > 0) fwrite(buf, 1, n, b);
+    if (a) fclose(a);
+    if (b) fclose(b);
+  }
+
+  // One power cycle: boot from the file, then (optionally) edit with a cut at write cutAt
+  void run(unsigned seed, long cutAt) {
+    inChild([&] {
+      host::nvs.file = NVS_FILE;
+      host::nvs.load();
+      settings_module::begin();
+      host::nvs.resetCounters();
+      host::nvs.cutAt = cutAt;
+      srand(seed);
+      sh->done = 0;
+      sh->after[0] = snap();
+      for (int e = 1; e <= EDITS; ++e) {
+        edit();
+        sh->pending = snap();
+        settings_module::flushNow();
+        sh->after[e] = snap();
+        sh->done = e;
+      }
+      sh->writes    = host::nvs.writes + host::nvs.removes;
+      sh->nvsWrites = settings_module::nvsWrites();
+      sh->nvsBytes  = settings_module::nvsBytesWritten();
+      sh->hostBytes = host::nvs.bytesWritten;
+    });
+  }
+
+  void bootAndSnap() {
+    inChild([] {
+      host::nvs.file = NVS_FILE;
+      host::nvs.load();
+      settings_module::begin();
+      sh->booted = snap();
+    });
+  }
+
+  int main(const char* name) {
+    sh = (Shared*)mmap(nullptr, sizeof(Shared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    // Factory image every trial starts from
+    remove(NVS_FILE);
+    bootAndSnap();
+    copyFile(NVS_FILE, BASE_FILE);
+
+    int trials = 0, bad = 0;
+    for (unsigned seed = 1; seed <= SEEDS; ++seed) {
+      copyFile(BASE_FILE, NVS_FILE);
+      run(seed, -1);
+      const uint32_t writes = sh->writes;
+      Snap expect[EDITS + 1];
+      memcpy(expect, sh->after, sizeof(expect));
+      if (seed == 1) {
+        printf("%s: %d edits -> %u NVS writes, %u bytes (firmware estimate), %llu payload bytes; %.1f bytes/edit\n",
+               name, EDITS, (unsigned)sh->nvsWrites, (unsigned)sh->nvsBytes,
+               (unsigned long long)sh->hostBytes, (double)sh->nvsBytes / EDITS);
+      }
+
+      for (long k = 0; k <= (long)writes; ++k) {
+        copyFile(BASE_FILE, NVS_FILE);
+        run(seed, k);
+        const int done = sh->done;
+        const Snap pending = sh->pending;
+        bootAndSnap();
+        ++trials;
+        const bool ok = sh->booted == expect[done] || (done < EDITS && sh->booted == pending);
+        if (!ok && ++bad <= 5) fprintf(stderr, "%s: seed %u cut at write %ld: boot state is neither edit %d nor %d\n", name, seed, k, done, done + 1);
+      }
+    }
+    printf("%s: %d power cuts, %d bad\n", name, trials, bad);
+    CHECK_EQ(bad, 0);
+    return checkResult(name);
+  }
+}
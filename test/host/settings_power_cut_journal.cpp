@@ -0,0 +1,7 @@
+// host-flags: -DSETTINGS_BACKEND_JOURNAL=1
+// =============================
+// File: test/host/settings_power_cut_journal.cpp — power cuts, journal backend
+// =============================
+#include "settings_power_cut.h"
+
+int main() { return power_cut::main("settings_power_cut_journal"); }
@@ -0,0 +1,151 @@
+// =============================
+// File: test/host/settings_transfer_test.cpp — cfg export / import round trip
+// =============================
+// Exports from one unit, imports the text into a factory unit (a second
+// process) and exports again; the two exports must match. Also checks the
+// CRC the way settings_transfer.ps1 computes it, and the import range checks.
+#include <Arduino.h>
+#include <string>
+#include <vector>
+#include "host.h"
+#include "check.h"
+#include "settings_module.h"
+#include "settings_transfer.h"
+
+namespace {
+  struct Capture : Print {
+    std::string s;
+    size_t write(uint8_t c) override { s += (char)c; return 1; }
+    using Print::write;
+  };
+
+  std::vector<std::string> lines(const std::string& text) {
+    std::vector<std::string> out;
+    size_t at = 0;
+    for (size_t nl; (nl = text.find('\n', at)) != std::string::npos; at = nl + 1) {
+      std::string l = text.substr(at, nl - at);
+      if (!l.empty() && l.back() == '\r') l.pop_back();
+      out.push_back(l);
+    }
+    return out;
+  }
+
+  uint32_t crc32(uint32_t c, const uint8_t* p, size_t n) {
+    while (n--) { c ^= *p++; for (int k = 0; k < 8; ++k) c = (c >> 1) ^ (0xEDB88320UL & (0UL - (c & 1))); }
+    return c;
+  }
+
+  // Get-TransferCrc in settings_transfer.ps1: every line before "end", minus "cfg i ", plus "\n"
+  uint32_t scriptCrc(const std::vector<std::string>& ls) {
+    uint32_t c = 0xFFFFFFFFUL;
+    for (const std::string& l : ls) {
+      if (l.rfind("cfg i end ", 0) == 0) break;
+      const std::string body = l.substr(6) + "\n";
+      c = crc32(c, (const uint8_t*)body.data(), body.size());
+    }
+    return ~c;
+  }
+
+  // Feeds an export to the console parser, returns the device's replies
+  std::string import(const std::vector<std::string>& ls) {
+    Capture reply;
+    for (const std::string& l : ls) settings_transfer::importLine(l.c_str() + 6, reply);
+    return reply.s;
+  }
+
+  using settings_module::BUILTIN_FADER_LABELS;
+
+  // Blob offsets (settings_module.cpp), for building bad images
+  constexpr size_t OFF_MIRROR = 14, OFF_MODES = 40, MODE_SIZE = 16, OFF_FADER_LABEL = 8;
+
+  void refreshCrc(std::vector<uint8_t>& img) {
+    const uint32_t c = ~crc32(0xFFFFFFFFUL, img.data() + 8, img.size() - 8);
+    memcpy(img.data() + 4, &c, 4);
+  }
+
+  // Imports an image along with nf fader / ns stomp custom labels
+  bool importWith(const std::vector<uint8_t>& img, uint8_t nf, uint8_t ns) {
+    static const char* const L[] = { "A", "B" };
+    return settings_module::importImage(img.data(), img.size(), L, nf, L, ns);
+  }
+
+  std::vector<uint8_t> image() {
+    std::vector<uint8_t> img(settings_module::IMAGE_MAX_BYTES);
+    img.resize(settings_module::exportImage(img.data(), img.size()));
+    return img;
+  }
+}
+
+int main() {
+  // ---- Source unit
+  Capture first;
+  settings_module::begin();
+  settings_module::setBleMidiChannel(7);
+  settings_module::setMirrorDelay(1.2f);
+  settings_module::setPresetMode(3);
+  settings_module::setFaderCC(2, 99);
+  settings_module::addCustomFaderLabel("Gain");
+  settings_module::addCustomFaderLabel("Drive");
+  settings_module::addCustomStompLabel("Boost");
+  settings_module::setFaderLabelIndex(1, BUILTIN_FADER_LABELS + 1);   // custom "Drive"
+  settings_module::setStompLabelIndex(0, settings_module::BUILTIN_STOMP_LABELS);
+  settings_module::flushNow();
+  settings_transfer::exportTo(first);
+  const std::vector<std::string> exported = lines(first.s);
+
+  CHECK(exported.size() > 3);
+  char endLine[32]; snprintf(endLine, sizeof(endLine), "cfg i end %X", (unsigned)scriptCrc(exported));
+  CHECK(exported.back() == endLine);
+
+  // ---- Factory unit: import, then export again
+  host::nvs.store.clear();
+  inChild([&] {
+    settings_module::begin();
+    const std::string reply = import(exported);
+    CHECK(reply.find("[cfg] import ok") != std::string::npos);
+    CHECK_EQ(settings_module::getBleMidiChannel(), 7);
+    CHECK_EQ(settings_module::getPresetMode(), 3);
+    CHECK_EQ(settings_module::getFaderCC(2), 99);
+    CHECK_EQ(settings_module::getFaderLabelIndex(1), BUILTIN_FADER_LABELS + 1);
+    CHECK_EQ(settings_module::getCustomFaderLabelCount(), 2);
+    CHECK(!strcmp(settings_module::getCustomFaderLabel(1), "Drive"));
+    Capture second;
+    settings_transfer::exportTo(second);
+    CHECK(second.s == first.s);
+  });
+
+  // ---- Range checks on the image (source unit, labels as exported: 2 / 1)
+  const std::vector<uint8_t> good = image();
+  CHECK(importWith(good, 2, 1));
+
+  std::vector<uint8_t> bad = good;
+  const uint16_t tooShort = 50, tooLong = 3001;
+  memcpy(&bad[OFF_MIRROR], &tooShort, 2); refreshCrc(bad);
+  CHECK(!importWith(bad, 2, 1));
+  bad = good; memcpy(&bad[OFF_MIRROR], &tooLong, 2); refreshCrc(bad);
+  CHECK(!importWith(bad, 2, 1));
+
+  // Mode 3's fader 1 points at custom label 1: fine with 2 labels, not with 1
+  CHECK_EQ(good[OFF_MODES + 3 * MODE_SIZE + OFF_FADER_LABEL + 1], BUILTIN_FADER_LABELS + 1);
+  CHECK(!importWith(good, 1, 1));
+  bad = good; bad[OFF_MODES + 5 * MODE_SIZE + OFF_FADER_LABEL] = BUILTIN_FADER_LABELS + 2; refreshCrc(bad);
+  CHECK(!importWith(bad, 2, 1));
+  // Built-in labels stay valid with empty pools
+  bad = good; bad[OFF_MODES + 3 * MODE_SIZE + OFF_FADER_LABEL + 1] = BUILTIN_FADER_LABELS - 1; refreshCrc(bad);
+  CHECK(importWith(bad, 0, 1));
+  CHECK(!importWith(bad, 0, 0));   // stomp 0 is still custom
+
+  // ---- A unit without custom labels takes back its own export of a built-in label
+  inChild([&] {
+    settings_module::applyPresetDefaults(3);
+    settings_module::replaceCustomFaderLabels(nullptr, 0);
+    settings_module::replaceCustomStompLabels(nullptr, 0);
+    settings_module::setFaderLabelIndex(0, 5);
+    Capture out;
+    settings_transfer::exportTo(out);
+    CHECK(import(lines(out.s)).find("[cfg] import ok") != std::string::npos);
+    CHECK_EQ(settings_module::getFaderLabelIndex(0), 5);
+  });
+
+  return checkResult("settings_transfer_test");
+}
@@ -0,0 +1,3 @@
+#pragma once
+#include <Arduino.h>
+class Adafruit_MAX17048{public: bool begin(); float cellPercent(); float cellVoltage(); void quickStart(); bool isDeviceReady();};
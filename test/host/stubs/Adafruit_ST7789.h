@@ -0,0 +1,14 @@
+// =============================
+// File: test/host/stubs/Adafruit_ST7789.h — host model of the ST7789 driver
+// =============================
+#pragma once
+#include "Adafruit_ST77xx.h"
+
+class Adafruit_ST7789 : public Adafruit_ST77xx {
+public:
+  Adafruit_ST7789(int8_t cs, int8_t dc, int8_t rst);
+  void setRotation(uint8_t m) override;
+  void init(uint16_t width, uint16_t height, uint8_t spiMode = SPI_MODE0);
+private:
+  uint16_t windowWidth = 240, windowHeight = 320;
+};
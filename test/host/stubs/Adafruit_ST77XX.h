@@ -0,0 +1,2 @@
+#pragma once
+#include "Adafruit_ST77xx.h"
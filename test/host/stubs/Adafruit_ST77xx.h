@@ -0,0 +1,29 @@
+// =============================
+// File: test/host/stubs/Adafruit_ST77xx.h — host model of the ST77xx driver
+// =============================
+#pragma once
+#include "Adafruit_SPITFT.h"
+
+#define ST77XX_BLACK 0x0000
+#define ST77XX_WHITE 0xFFFF
+#define ST77XX_RED 0xF800
+#define ST77XX_GREEN 0x07E0
+#define ST77XX_BLUE 0x001F
+#define ST77XX_CYAN 0x07FF
+#define ST77XX_MAGENTA 0xF81F
+#define ST77XX_YELLOW 0xFFE0
+#define ST77XX_ORANGE 0xFC00
+#define ST77XX_SLPIN 0x10
+#define ST77XX_SLPOUT 0x11
+#define ST77XX_DISPOFF 0x28
+#define ST77XX_DISPON 0x29
+
+class Adafruit_ST77xx : public Adafruit_SPITFT {
+public:
+  Adafruit_ST77xx(uint16_t w, uint16_t h, int8_t CS, int8_t RS, int8_t RST = -1);
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override;
+  void setRotation(uint8_t r) override;
+  void enableDisplay(bool enable);
+  void enableTearing(bool enable);
+  void enableSleep(bool enable);
+};
@@ -0,0 +1,160 @@
+// =============================
+// File: test/host/stubs/Arduino.h — host stand-in for the ESP32 Arduino core
+// =============================
+// Only what the firmware uses. Print formats like the real core; time, pins
+// and timers are driven by the test through host.h.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+using std::min; using std::max;
+typedef bool boolean;
+typedef uint8_t byte;
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define IRAM_ATTR
+
+#define HEX 16
+#define BIN 2
+#define DEC 10
+#define OUTPUT 1
+#define INPUT 0
+#define INPUT_PULLUP 2
+#define LOW 0
+#define HIGH 1
+#define SPI_MODE0 0
+#define SERIAL_8N1 0x800001c
+
+class String {
+public:
+  String(const char* s = "") : s_(s ? s : "") {}
+  String(const std::string& s) : s_(s) {}
+  String(int v)      : s_(std::to_string(v)) {}
+  String(unsigned v) : s_(std::to_string(v)) {}
+  String(long v)     : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+  String(uint8_t v)  : s_(std::to_string(v)) {}
+  const char* c_str() const { return s_.c_str(); }
+  size_t length() const { return s_.size(); }
+  String operator+(const String& o) const { return String(s_ + o.s_); }
+  String operator+(const char* o) const { return String(s_ + o); }
+  String operator+(int v) const { return String(s_ + std::to_string(v)); }
+  String operator+(unsigned v) const { return String(s_ + std::to_string(v)); }
+  String operator+(unsigned long v) const { return String(s_ + std::to_string(v)); }
+  String operator+(uint8_t v) const { return String(s_ + std::to_string(v)); }
+  String& operator+=(char c) { s_ += c; return *this; }
+  String& operator+=(const char* o) { s_ += o; return *this; }
+  bool operator==(const char* o) const { return s_ == o; }
+  char operator[](size_t i) const { return i < s_.size() ? s_[i] : 0; }
+private:
+  std::string s_;
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t* b, size_t n) { size_t k = 0; while (n--) k += write(*b++); return k; }
+  size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+
+  size_t print(const char* s)                { return write(s); }
+  size_t print(const __FlashStringHelper* s) { return write((const char*)s); }
+  size_t print(const String& s)              { return write(s.c_str()); }
+  size_t print(char c)                       { return write((uint8_t)c); }
+  size_t print(unsigned char v, int base = DEC)  { return printNumber(v, base); }
+  size_t print(int v, int base = DEC)            { return printSigned(v, base); }
+  size_t print(unsigned v, int base = DEC)       { return printNumber(v, base); }
+  size_t print(long v, int base = DEC)           { return printSigned(v, base); }
+  size_t print(unsigned long v, int base = DEC)  { return printNumber(v, base); }
+  size_t print(long long v, int base = DEC)      { return printSigned(v, base); }
+  size_t print(unsigned long long v, int base = DEC) { return printNumber(v, base); }
+  size_t print(double v, int digits = 2) {
+    char b[48]; snprintf(b, sizeof(b), "%.*f", digits, v); return write(b);
+  }
+
+  template <typename T> size_t println(T v) { const size_t n = print(v); return n + println(); }
+  template <typename T> size_t println(T v, int f) { const size_t n = print(v, f); return n + println(); }
+  size_t println() { return write("\r\n"); }
+
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+private:
+  size_t printNumber(unsigned long long v, int base) {
+    char b[72]; int i = sizeof(b) - 1; b[i] = 0;
+    if (base < 2) base = 10;
+    do { const int d = (int)(v % base); b[--i] = (char)(d < 10 ? '0' + d : 'A' + d - 10); v /= base; } while (v);
+    return write(b + i);
+  }
+  size_t printSigned(long long v, int base) {
+    if (base == 10 && v < 0) return print('-') + printNumber((unsigned long long)(-v), 10);
+    return printNumber((unsigned long long)v, base);
+  }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  virtual int peek() { return -1; }
+  size_t write(uint8_t) override { return 1; }
+  using Print::write;
+  void setTimeout(unsigned long) {}
+};
+
+// Serial prints to stdout while host::serialEcho is on; Serial1 discards and
+// always has room
+class HardwareSerial : public Stream {
+public:
+  explicit HardwareSerial(int n) : n_(n) {}
+  void begin(unsigned long baud, uint32_t = SERIAL_8N1, int8_t = -1, int8_t = -1);
+  void end() {}
+  size_t setTxBufferSize(size_t n) { return n; }
+  size_t setRxBufferSize(size_t n) { return n; }
+  size_t write(uint8_t c) override;
+  using Print::write;
+  int availableForWrite() override { return 128; }
+  operator bool() const { return true; }
+private:
+  int n_;
+};
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+enum { ADC_0db, ADC_2_5db, ADC_6db, ADC_11db };
+void     pinMode(uint8_t pin, uint8_t mode);
+void     digitalWrite(uint8_t pin, uint8_t v);
+int      digitalRead(uint8_t pin);
+int      analogRead(uint8_t pin);
+uint32_t analogReadMilliVolts(uint8_t pin);
+void     analogReadResolution(uint8_t bits);
+void     analogSetPinAttenuation(uint8_t pin, int att);
+
+bool     ledcAttach(uint8_t pin, uint32_t freq, uint8_t res);
+bool     ledcAttachChannel(uint8_t pin, uint32_t freq, uint8_t res, uint8_t ch);
+bool     ledcWrite(uint8_t pin, uint32_t duty);
+uint32_t ledcRead(uint8_t pin);
+bool     ledcFade(uint8_t pin, uint32_t startDuty, uint32_t targetDuty, int ms);
+
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(x) (void)(x)
+#define portEXIT_CRITICAL(x) (void)(x)
+#define portENTER_CRITICAL_ISR(x) (void)(x)
+#define portEXIT_CRITICAL_ISR(x) (void)(x)
@@ -0,0 +1,27 @@
+#pragma once
+#include <Arduino.h>
+typedef uint8_t esp_bd_addr_t[6];
+union esp_ble_gatts_cb_param_t {
+  struct { uint16_t conn_id; esp_bd_addr_t remote_bda; struct { uint16_t interval, latency, timeout; } conn_params; } connect;
+  struct { uint16_t conn_id; uint16_t mtu; } mtu;
+};
+class BLEUUID { public: BLEUUID(const char*){} };
+class BLEDescriptor { public: virtual ~BLEDescriptor(){} };
+class BLE2902 : public BLEDescriptor {};
+class BLECharacteristic;
+class BLECharacteristicCallbacks { public: virtual ~BLECharacteristicCallbacks(){} virtual void onWrite(BLECharacteristic*){} };
+class BLECharacteristic { public:
+  static const uint32_t PROPERTY_READ=1, PROPERTY_WRITE=2, PROPERTY_NOTIFY=4, PROPERTY_WRITE_NR=8;
+  void addDescriptor(BLEDescriptor*){} void setValue(uint8_t*, size_t){} void notify(bool=true){} void setCallbacks(BLECharacteristicCallbacks*){} };
+class BLEService { public: BLECharacteristic* createCharacteristic(const char*, uint32_t){ return nullptr; } void start(){} };
+class BLEServer;
+class BLEServerCallbacks { public: virtual ~BLEServerCallbacks(){}
+  virtual void onConnect(BLEServer*){} virtual void onConnect(BLEServer*, esp_ble_gatts_cb_param_t*){}
+  virtual void onDisconnect(BLEServer*){} virtual void onMtuChanged(BLEServer*, esp_ble_gatts_cb_param_t*){} };
+class BLEServer { public: BLEService* createService(const char*){ return nullptr; } void setCallbacks(BLEServerCallbacks*){}
+  void updateConnParams(esp_bd_addr_t, uint16_t, uint16_t, uint16_t, uint16_t){} uint16_t getPeerMTU(uint16_t){ return 23; } uint32_t getConnectedCount(){ return 0; } };
+class BLEAdvertising { public: void addServiceUUID(const char*){} void setScanResponse(bool){} void setMinPreferred(uint16_t){} };
+typedef int esp_gap_ble_cb_event_t;
+#define ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT 20
+typedef union { struct { int status; esp_bd_addr_t bda; uint16_t min_int, max_int, latency, conn_int, timeout; } update_conn_params; } esp_ble_gap_cb_param_t;
+class BLEDevice { public: static void setCustomGapHandler(void (*)(esp_gap_ble_cb_event_t, esp_ble_gap_cb_param_t*)){} static void init(const char*){} static BLEServer* createServer(){ return nullptr; } static BLEAdvertising* getAdvertising(){ return nullptr; } static void startAdvertising(){} static void setMTU(uint16_t){} };
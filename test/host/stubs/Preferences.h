@@ -0,0 +1,13 @@
+#pragma once
+#include <Arduino.h>
+class Preferences { public:
+ bool begin(const char*, bool=false); void end();
+ bool isKey(const char*); bool remove(const char*); bool clear();
+ uint8_t getUChar(const char*, uint8_t=0); size_t putUChar(const char*, uint8_t);
+ uint32_t getUInt(const char*, uint32_t=0); size_t putUInt(const char*, uint32_t);
+ uint64_t getULong64(const char*, uint64_t=0); size_t putULong64(const char*, uint64_t);
+ float getFloat(const char*, float=0); size_t putFloat(const char*, float);
+ String getString(const char*, String=String()); size_t getString(const char*, char*, size_t); size_t putString(const char*, const char*); size_t putString(const char*, String);
+ size_t getBytesLength(const char*); size_t getBytes(const char*, void*, size_t); size_t putBytes(const char*, const void*, size_t);
+ size_t freeEntries();
+};
@@ -0,0 +1,4 @@
+#pragma once
+#include <Arduino.h>
+class SPIClass { public: void begin(int8_t, int8_t, int8_t, int8_t); };
+extern SPIClass SPI;
@@ -0,0 +1,4 @@
+#pragma once
+typedef enum { LEDC_LOW_SPEED_MODE = 0 } ledc_mode_t;
+typedef int ledc_channel_t;
+int ledc_fade_stop(ledc_mode_t, ledc_channel_t);   // counts host::ledcFadeStopErrors
@@ -0,0 +1,26 @@
+#pragma once
+#include <stddef.h>
+#include <esp_timer.h>
+#include <esp_intr_alloc.h>
+typedef enum { UART_NUM_0, UART_NUM_1, UART_NUM_2 } uart_port_t;
+typedef enum { UART_DATA_8_BITS = 3 } uart_word_length_t;
+typedef enum { UART_PARITY_DISABLE = 0 } uart_parity_t;
+typedef enum { UART_STOP_BITS_1 = 1 } uart_stop_bits_t;
+typedef enum { UART_HW_FLOWCTRL_DISABLE = 0 } uart_hw_flowcontrol_t;
+typedef enum { UART_SCLK_DEFAULT = 0 } uart_sclk_t;
+typedef struct {
+  int baud_rate;
+  uart_word_length_t data_bits;
+  uart_parity_t parity;
+  uart_stop_bits_t stop_bits;
+  uart_hw_flowcontrol_t flow_ctrl;
+  uint8_t rx_flow_ctrl_thresh;
+  uart_sclk_t source_clk;
+} uart_config_t;
+#define UART_PIN_NO_CHANGE (-1)
+typedef void* QueueHandle_t;
+esp_err_t uart_driver_install(uart_port_t, int rx, int tx, int queueSize, QueueHandle_t* queue, int intrFlags);
+esp_err_t uart_param_config(uart_port_t, const uart_config_t*);
+esp_err_t uart_set_pin(uart_port_t, int tx, int rx, int rts, int cts);
+esp_err_t uart_get_tx_buffer_free_size(uart_port_t, size_t* size);
+int       uart_write_bytes(uart_port_t, const void* src, size_t size);
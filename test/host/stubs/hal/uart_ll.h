@@ -0,0 +1,7 @@
+#pragma once
+#include <stdint.h>
+typedef struct uart_dev_s uart_dev_t;
+uart_dev_t* uart_ll_hw_stub(int);
+#define UART_LL_GET_HW(n) uart_ll_hw_stub(n)
+uint32_t uart_ll_get_txfifo_len(uart_dev_t*);
+void uart_ll_write_txfifo(uart_dev_t*, const uint8_t*, uint32_t);
@@ -0,0 +1,66 @@
+// =============================
+// File: test/host/stubs/host.h — test-side controls for the host stand-ins
+// =============================
+#pragma once
+#include <Arduino.h>
+#include <driver/gptimer.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace host {
+  // ---- Time. millis()/micros() read a virtual clock; delay() advances it.
+  uint64_t nowUs();
+  void     advanceUs(uint64_t us);     // also runs due esp_timer callbacks
+
+  // ---- Serial. Off by default so test output stays readable.
+  extern bool serialEcho;
+  extern std::string* serialLog;       // when set, Serial output is appended here
+  // When set, Serial output costs UART0 wire time at the Serial.begin() baud:
+  // a write blocks (advancing the clock) while the 128-byte FIFO is full, as
+  // with the core's default of no TX ring. Off: output takes no time.
+  extern bool serialWireTime;
+
+  // ---- Pins
+  extern int adc[64];                  // analogRead() / analogReadMilliVolts() per pin
+  extern int digital[64];              // digitalRead() per pin
+
+  // ---- LEDC. The first ledcFade() installs the fade service; a
+  // ledc_fade_stop() before that is an IDF error (logged), counted here.
+  extern uint32_t ledcFadeStopErrors;
+
+  // ---- UART1 (DIN MIDI) through the IDF driver. The driver's TX interrupt
+  // is taken to move bytes into the FIFO at once; they leave at 31.25 kbaud.
+  uint32_t uartQueued();               // bytes not yet on the wire (driver + FIFO)
+  uint32_t uartWritten();              // bytes ever written, realtime included
+  uint64_t uartIdleAtUs();             // when the last byte written so far has left
+  extern int uartIntrFlags;            // as given to uart_driver_install()
+
+  // ---- gptimer (one timer is enough for the firmware)
+  struct Timer {
+    bool     attached = false, running = false, autoreload = false;
+    uint32_t hz = 0;
+    uint64_t alarm = 0;                // ticks of 1/hz
+    int      intrPriority = 0;
+    gptimer_alarm_cb_t onAlarm = nullptr;
+    void*    user = nullptr;
+    void fire();                       // one alarm, as the interrupt would
+  };
+  extern Timer timer;
+
+  // ---- NVS (Preferences). One flat key space; namespaces are ignored.
+  struct Nvs {
+    std::map<std::string, std::vector<uint8_t>> store;
+    uint32_t reads = 0, writes = 0, removes = 0;
+    uint64_t bytesWritten = 0;         // payload bytes of every put
+    // Power cut: once `writes + removes` reaches cutAt, the next write or
+    // remove never lands and cutHook() runs (default: _exit(0)).
+    long     cutAt = -1;
+    void   (*cutHook)() = nullptr;
+    const char* file = nullptr;        // if set, every change is saved here
+    void resetCounters() { reads = writes = removes = 0; bytesWritten = 0; }
+    bool load();                       // from `file`; false when missing
+    void save() const;
+  };
+  extern Nvs nvs;
+}
@@ -0,0 +1,210 @@
+// =============================
+// File: test/host/stubs/host_arduino.cpp — Arduino core, timers, bus stand-ins
+// =============================
+#include "host.h"
+#include <stdarg.h>
+#include <vector>
+#include <esp_timer.h>
+#include <SPI.h>
+#include <Wire.h>
+#include <Adafruit_MAX1704X.h>
+#include <hal/uart_ll.h>
+#include <driver/ledc.h>
+#include <driver/uart.h>
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+SPIClass SPI;
+TwoWire  Wire;
+
+namespace host {
+  bool  serialEcho = false;
+  bool  serialWireTime = false;
+  std::string* serialLog = nullptr;
+  int   adc[64] = {};
+  int   digital[64] = {};
+  int   uartIntrFlags = 0;
+  uint32_t ledcFadeStopErrors = 0;
+  Timer timer;
+}
+
+namespace {
+  uint32_t s_serialBaud     = 0;
+  uint64_t s_serialIdleAtNs = 0;   // when the last byte written leaves UART0
+}
+
+void HardwareSerial::begin(unsigned long baud, uint32_t, int8_t, int8_t) {
+  if (n_ == 0) s_serialBaud = (uint32_t)baud;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (n_ != 0) return 1;
+  if (host::serialWireTime && s_serialBaud) {
+    const uint64_t byteNs = 10000000000ULL / s_serialBaud, nowNs = host::nowUs() * 1000;
+    if (s_serialIdleAtNs < nowNs) s_serialIdleAtNs = nowNs;
+    const uint64_t fifoNs = 127 * byteNs;   // room for this byte once at most 127 are left
+    if (s_serialIdleAtNs - nowNs > fifoNs) host::advanceUs((s_serialIdleAtNs - nowNs - fifoNs + 999) / 1000);
+    s_serialIdleAtNs += byteNs;
+  }
+  if (host::serialLog) *host::serialLog += (char)c;
+  if (host::serialEcho) putchar(c);
+  return 1;
+}
+
+size_t Print::printf(const char* fmt, ...) {
+  char b[256];
+  va_list ap; va_start(ap, fmt);
+  const int n = vsnprintf(b, sizeof(b), fmt, ap);
+  va_end(ap);
+  return n > 0 ? write(b) : 0;
+}
+
+// ---- time + esp_timer
+struct esp_timer {
+  esp_timer_create_args_t args;
+  bool     armed;
+  uint64_t dueUs;
+};
+
+namespace {
+  uint64_t s_nowUs = 0;
+  std::vector<esp_timer*> s_espTimers;
+}
+
+uint64_t host::nowUs() { return s_nowUs; }
+
+void host::advanceUs(uint64_t us) {
+  const uint64_t until = s_nowUs + us;
+  for (;;) {
+    esp_timer* next = nullptr;
+    for (esp_timer* t : s_espTimers)
+      if (t->armed && t->dueUs <= until && (!next || t->dueUs < next->dueUs)) next = t;
+    if (!next) break;
+    s_nowUs = next->dueUs;
+    next->armed = false;
+    next->args.callback(next->args.arg);
+  }
+  s_nowUs = until;
+}
+
+unsigned long millis() { return (unsigned long)(s_nowUs / 1000); }
+unsigned long micros() { return (unsigned long)s_nowUs; }
+void delay(unsigned long ms) { host::advanceUs((uint64_t)ms * 1000); }
+void delayMicroseconds(unsigned int us) { host::advanceUs(us); }
+int64_t esp_timer_get_time() { return (int64_t)s_nowUs; }
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out) {
+  esp_timer* t = new esp_timer{ *args, false, 0 };
+  s_espTimers.push_back(t);
+  *out = t;
+  return ESP_OK;
+}
+esp_err_t esp_timer_start_once(esp_timer_handle_t t, uint64_t us) { t->armed = true; t->dueUs = s_nowUs + us; return ESP_OK; }
+esp_err_t esp_timer_stop(esp_timer_handle_t t) { t->armed = false; return ESP_OK; }
+
+// ---- pins
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int  digitalRead(uint8_t pin) { return host::digital[pin & 63]; }
+int  analogRead(uint8_t pin) { return host::adc[pin & 63]; }
+uint32_t analogReadMilliVolts(uint8_t pin) { return (uint32_t)host::adc[pin & 63]; }
+void analogReadResolution(uint8_t) {}
+void analogSetPinAttenuation(uint8_t, int) {}
+
+bool     ledcAttach(uint8_t, uint32_t, uint8_t) { return true; }
+bool     ledcAttachChannel(uint8_t, uint32_t, uint8_t, uint8_t) { return true; }
+bool     ledcWrite(uint8_t, uint32_t) { return true; }
+uint32_t ledcRead(uint8_t) { return 0; }
+namespace { bool s_fadeService = false; }
+bool     ledcFade(uint8_t, uint32_t, uint32_t, int) { s_fadeService = true; return true; }
+int      ledc_fade_stop(ledc_mode_t, ledc_channel_t) {
+  if (!s_fadeService) { ++host::ledcFadeStopErrors; return -1; }
+  return 0;
+}
+
+// ---- gptimer
+namespace { gptimer_handle_t timerHandle() { return reinterpret_cast<gptimer_handle_t>(&host::timer); } }
+esp_err_t gptimer_new_timer(const gptimer_config_t* c, gptimer_handle_t* out) {
+  host::timer.hz = c->resolution_hz;
+  host::timer.intrPriority = c->intr_priority;
+  *out = timerHandle();
+  return ESP_OK;
+}
+esp_err_t gptimer_register_event_callbacks(gptimer_handle_t, const gptimer_event_callbacks_t* cbs, void* user) {
+  host::timer.onAlarm = cbs->on_alarm; host::timer.user = user; host::timer.attached = true;
+  return ESP_OK;
+}
+esp_err_t gptimer_enable(gptimer_handle_t) { return ESP_OK; }
+esp_err_t gptimer_set_alarm_action(gptimer_handle_t, const gptimer_alarm_config_t* a) {
+  host::timer.alarm = a->alarm_count; host::timer.autoreload = a->flags.auto_reload_on_alarm;
+  return ESP_OK;
+}
+esp_err_t gptimer_set_raw_count(gptimer_handle_t, uint64_t) { return ESP_OK; }
+esp_err_t gptimer_start(gptimer_handle_t) { host::timer.running = true; return ESP_OK; }
+esp_err_t gptimer_stop(gptimer_handle_t)  { host::timer.running = false; return ESP_OK; }
+
+void host::Timer::fire() {
+  const gptimer_alarm_event_data_t e = { alarm, alarm };
+  if (running && onAlarm) onAlarm(timerHandle(), &e, user);
+}
+
+// ---- buses and parts
+void SPIClass::begin(int8_t, int8_t, int8_t, int8_t) {}
+bool TwoWire::begin(int, int, uint32_t) { return true; }
+bool  Adafruit_MAX17048::begin() { return true; }
+float Adafruit_MAX17048::cellPercent() { return 76.0f; }
+float Adafruit_MAX17048::cellVoltage() { return 3.9f; }
+void  Adafruit_MAX17048::quickStart() {}
+bool  Adafruit_MAX17048::isDeviceReady() { return true; }
+
+// ---- UART1 (DIN MIDI): driver buffer and TX FIFO, drained at 31.25 kbaud on
+// the virtual clock. Only the byte count matters: the first 128 are in the FIFO.
+namespace {
+  constexpr uint32_t UART_FIFO    = 128;
+  constexpr uint32_t UART_BYTE_US = 320;
+}
+struct uart_dev_s { uint32_t written, queued, txBuf; uint64_t atUs; };
+namespace {
+  uart_dev_s s_uart1 = {};
+
+  void uartDrain(uart_dev_s& u) {
+    const uint64_t n = (s_nowUs - u.atUs) / UART_BYTE_US;
+    if (n >= u.queued) { u.queued = 0; u.atUs = s_nowUs; return; }
+    u.queued -= (uint32_t)n;
+    u.atUs += n * UART_BYTE_US;
+  }
+  uint32_t uartFifo(uart_dev_s& u) { uartDrain(u); return std::min(u.queued, UART_FIFO); }
+
+  void uartQueue(uart_dev_s& u, uint32_t n) {
+    uartDrain(u);
+    if (!u.queued) u.atUs = s_nowUs;
+    u.queued += n; u.written += n;
+  }
+}
+
+uint32_t host::uartQueued() { uartDrain(s_uart1); return s_uart1.queued; }
+uint32_t host::uartWritten() { return s_uart1.written; }
+uint64_t host::uartIdleAtUs() { uartDrain(s_uart1); return s_uart1.atUs + (uint64_t)s_uart1.queued * UART_BYTE_US; }
+
+esp_err_t uart_driver_install(uart_port_t, int, int tx, int, QueueHandle_t*, int flags) {
+  s_uart1.txBuf = (uint32_t)tx;
+  host::uartIntrFlags = flags;
+  return ESP_OK;
+}
+esp_err_t uart_param_config(uart_port_t, const uart_config_t*) { return ESP_OK; }
+esp_err_t uart_set_pin(uart_port_t, int, int, int, int) { return ESP_OK; }
+esp_err_t uart_get_tx_buffer_free_size(uart_port_t, size_t* size) {
+  *size = s_uart1.txBuf - (s_uart1.queued - uartFifo(s_uart1));
+  return ESP_OK;
+}
+int uart_write_bytes(uart_port_t p, const void*, size_t n) {
+  size_t room = 0;
+  uart_get_tx_buffer_free_size(p, &room);
+  if (n > room) n = room;   // the real one would wait
+  uartQueue(s_uart1, (uint32_t)n);
+  return (int)n;
+}
+
+uart_dev_t* uart_ll_hw_stub(int) { return &s_uart1; }
+uint32_t uart_ll_get_txfifo_len(uart_dev_t* hw) { return UART_FIFO - uartFifo(*hw); }
+void uart_ll_write_txfifo(uart_dev_t* hw, const uint8_t*, uint32_t n) { uartQueue(*hw, n); }
@@ -0,0 +1,302 @@
+// =============================
+// File: test/host/stubs/host_gfx.cpp — Adafruit GFX / SPITFT / ST7789 on the host
+// =============================
+// Follows the library's call decomposition (which primitive ends in which
+// address windows) and clipping; the wire itself is not modelled. The
+// classic 5x7 font is not bundled: without setFont() characters only
+// advance the cursor.
+#include <Adafruit_ST7789.h>
+
+#define swap16(a, b) do { int16_t t_ = a; a = b; b = t_; } while (0)
+
+// ---- Adafruit_GFX
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+void Adafruit_GFX::startWrite() {}
+void Adafruit_GFX::endWrite() {}
+void Adafruit_GFX::writePixel(int16_t x, int16_t y, uint16_t c) { drawPixel(x, y, c); }
+void Adafruit_GFX::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) { drawFastVLine(x, y, h, c); }
+void Adafruit_GFX::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) { drawFastHLine(x, y, w, c); }
+void Adafruit_GFX::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) { fillRect(x, y, w, h, c); }
+void Adafruit_GFX::setRotation(uint8_t r) {
+  rotation = r & 3;
+  _width  = (rotation & 1) ? HEIGHT : WIDTH;
+  _height = (rotation & 1) ? WIDTH : HEIGHT;
+}
+void Adafruit_GFX::invertDisplay(bool) {}
+
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t c) {
+  const bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) { swap16(x0, y0); swap16(x1, y1); }
+  if (x0 > x1) { swap16(x0, x1); swap16(y0, y1); }
+  const int16_t dx = x1 - x0, dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  const int16_t ystep = y0 < y1 ? 1 : -1;
+  for (; x0 <= x1; x0++) {
+    if (steep) writePixel(y0, x0, c); else writePixel(x0, y0, c);
+    err -= dy;
+    if (err < 0) { y0 += ystep; err += dx; }
+  }
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) {
+  startWrite(); writeLine(x, y, x, y + h - 1, c); endWrite();
+}
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) {
+  startWrite(); writeLine(x, y, x + w - 1, y, c); endWrite();
+}
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+  startWrite();
+  for (int16_t i = x; i < x + w; i++) writeFastVLine(i, y, h, c);
+  endWrite();
+}
+void Adafruit_GFX::fillScreen(uint16_t c) { fillRect(0, 0, _width, _height, c); }
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t c) {
+  if (x0 == x1) {
+    if (y0 > y1) swap16(y0, y1);
+    drawFastVLine(x0, y0, y1 - y0 + 1, c);
+  } else if (y0 == y1) {
+    if (x0 > x1) swap16(x0, x1);
+    drawFastHLine(x0, y0, x1 - x0 + 1, c);
+  } else {
+    startWrite(); writeLine(x0, y0, x1, y1, c); endWrite();
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+  startWrite();
+  writeFastHLine(x, y, w, c);
+  writeFastHLine(x, y + h - 1, w, c);
+  writeFastVLine(x, y, h, c);
+  writeFastVLine(x + w - 1, y, h, c);
+  endWrite();
+}
+
+void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t c) {
+  int16_t a, b, y, last;
+  if (y0 > y1) { swap16(y0, y1); swap16(x0, x1); }
+  if (y1 > y2) { swap16(y2, y1); swap16(x2, x1); }
+  if (y0 > y1) { swap16(y0, y1); swap16(x0, x1); }
+
+  startWrite();
+  if (y0 == y2) {   // all on one scanline
+    a = b = x0;
+    if (x1 < a) a = x1; else if (x1 > b) b = x1;
+    if (x2 < a) a = x2; else if (x2 > b) b = x2;
+    writeFastHLine(a, y0, b - a + 1, c);
+    endWrite();
+    return;
+  }
+
+  const int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0,
+                dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+  last = (y1 == y2) ? y1 : y1 - 1;
+  for (y = y0; y <= last; y++) {
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01; sb += dx02;
+    if (a > b) swap16(a, b);
+    writeFastHLine(a, y, b - a + 1, c);
+  }
+  sa = (int32_t)dx12 * (y - y1);
+  sb = (int32_t)dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12; sb += dx02;
+    if (a > b) swap16(a, b);
+    writeFastHLine(a, y, b - a + 1, c);
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) {
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++)
+    for (int16_t i = 0; i < w; i++) writePixel(x + i, y, bitmap[j * w + i]);
+  endWrite();
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char ch, uint16_t color, uint16_t bg, uint8_t size) {
+  if (!gfxFont) {
+    // Classic font: only the background cell is modelled
+    if (bg != color) fillRect(x, y, 6 * size, 8 * size, bg);
+    return;
+  }
+  ch -= (uint8_t)gfxFont->first;
+  const GFXglyph* glyph = &gfxFont->glyph[ch];
+  const uint8_t* bitmap = gfxFont->bitmap;
+  uint16_t bo = glyph->bitmapOffset;
+  const uint8_t w = glyph->width, h = glyph->height;
+  const int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+  uint8_t bits = 0, bit = 0;
+
+  startWrite();
+  for (uint8_t yy = 0; yy < h; yy++) {
+    for (uint8_t xx = 0; xx < w; xx++) {
+      if (!(bit++ & 7)) bits = bitmap[bo++];
+      if (bits & 0x80) {
+        if (size == 1) writePixel(x + xo + xx, y + yo + yy, color);
+        else writeFillRect(x + (xo + xx) * size, y + (yo + yy) * size, size, size, color);
+      }
+      bits <<= 1;
+    }
+  }
+  endWrite();
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (!gfxFont) {
+    if (c == '\n') { cursor_x = 0; cursor_y += textsize * 8; }
+    else if (c != '\r') {
+      if (wrap && cursor_x + textsize * 6 > _width) { cursor_x = 0; cursor_y += textsize * 8; }
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+      cursor_x += textsize * 6;
+    }
+    return 1;
+  }
+  if (c == '\n') { cursor_x = 0; cursor_y += (int16_t)textsize * gfxFont->yAdvance; }
+  else if (c != '\r' && c >= gfxFont->first && c <= gfxFont->last) {
+    const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+    const uint8_t w = glyph->width, h = glyph->height;
+    if (w > 0 && h > 0) {
+      const int16_t xo = glyph->xOffset;
+      if (wrap && cursor_x + textsize * (xo + w) > _width) {
+        cursor_x = 0;
+        cursor_y += (int16_t)textsize * gfxFont->yAdvance;
+      }
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    }
+    cursor_x += glyph->xAdvance * (int16_t)textsize;
+  }
+  return 1;
+}
+
+void Adafruit_GFX::setFont(const GFXfont* f) {
+  if (f) { if (!gfxFont) cursor_y += 6; }
+  else if (gfxFont) cursor_y -= 6;
+  gfxFont = f;
+}
+
+void Adafruit_GFX::charBounds(unsigned char c, int16_t* x, int16_t* y, int16_t* minx, int16_t* miny, int16_t* maxx, int16_t* maxy) {
+  if (gfxFont) {
+    if (c == '\n') { *x = 0; *y += textsize * gfxFont->yAdvance; return; }
+    if (c == '\r' || c < gfxFont->first || c > gfxFont->last) return;
+    const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+    const uint8_t gw = glyph->width, gh = glyph->height, xa = glyph->xAdvance;
+    const int8_t xo = glyph->xOffset, yo = glyph->yOffset;
+    if (wrap && *x + ((int16_t)xo + gw) * textsize > _width) { *x = 0; *y += textsize * gfxFont->yAdvance; }
+    const int16_t x1 = *x + xo * textsize, y1 = *y + yo * textsize;
+    const int16_t x2 = x1 + gw * textsize - 1, y2 = y1 + gh * textsize - 1;
+    if (x1 < *minx) *minx = x1;
+    if (y1 < *miny) *miny = y1;
+    if (x2 > *maxx) *maxx = x2;
+    if (y2 > *maxy) *maxy = y2;
+    *x += xa * textsize;
+    return;
+  }
+  if (c == '\n') { *x = 0; *y += textsize * 8; return; }
+  if (c == '\r') return;
+  if (wrap && *x + textsize * 6 > _width) { *x = 0; *y += textsize * 8; }
+  const int16_t x2 = *x + textsize * 6 - 1, y2 = *y + textsize * 8 - 1;
+  if (x2 > *maxx) *maxx = x2;
+  if (y2 > *maxy) *maxy = y2;
+  if (*x < *minx) *minx = *x;
+  if (*y < *miny) *miny = *y;
+  *x += textsize * 6;
+}
+
+void Adafruit_GFX::getTextBounds(const char* str, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+  int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+  *x1 = x; *y1 = y; *w = *h = 0;
+  for (uint8_t c; (c = (uint8_t)*str++);) charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+  if (maxx >= minx) { *x1 = minx; *w = maxx - minx + 1; }
+  if (maxy >= miny) { *y1 = miny; *h = maxy - miny + 1; }
+}
+
+// ---- Adafruit_SPITFT: every primitive ends in setAddrWindow()
+Adafruit_SPITFT::Adafruit_SPITFT(uint16_t w, uint16_t h, int8_t, int8_t, int8_t) : Adafruit_GFX(w, h) {}
+
+void Adafruit_SPITFT::startWrite() {}
+void Adafruit_SPITFT::endWrite() {}
+
+void Adafruit_SPITFT::writeFillRectPreclipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+  setAddrWindow(x, y, w, h);
+  writeColor(c, (uint32_t)w * h);
+}
+
+void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t) {
+  if (x >= 0 && x < _width && y >= 0 && y < _height) setAddrWindow(x, y, 1, 1);
+}
+
+void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+  if (!w || !h) return;
+  if (w < 0) { x += w + 1; w = -w; }
+  if (x >= _width) return;
+  if (h < 0) { y += h + 1; h = -h; }
+  if (y >= _height) return;
+  const int16_t x2 = x + w - 1, y2 = y + h - 1;
+  if (x2 < 0 || y2 < 0) return;
+  if (x < 0) { x = 0; w = x2 + 1; }
+  if (y < 0) { y = 0; h = y2 + 1; }
+  if (x2 >= _width) w = _width - x;
+  if (y2 >= _height) h = _height - y;
+  writeFillRectPreclipped(x, y, w, h, c);
+}
+
+void Adafruit_SPITFT::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) {
+  if (y < 0 || y >= _height || !w) return;
+  if (w < 0) { x += w + 1; w = -w; }
+  if (x >= _width) return;
+  const int16_t x2 = x + w - 1;
+  if (x2 < 0) return;
+  if (x < 0) { x = 0; w = x2 + 1; }
+  if (x2 >= _width) w = _width - x;
+  writeFillRectPreclipped(x, y, w, 1, c);
+}
+
+void Adafruit_SPITFT::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) {
+  if (x < 0 || x >= _width || !h) return;
+  if (h < 0) { y += h + 1; h = -h; }
+  if (y >= _height) return;
+  const int16_t y2 = y + h - 1;
+  if (y2 < 0) return;
+  if (y < 0) { y = 0; h = y2 + 1; }
+  if (y2 >= _height) h = _height - y;
+  writeFillRectPreclipped(x, y, 1, h, c);
+}
+
+void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t c) { startWrite(); writePixel(x, y, c); endWrite(); }
+void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) { startWrite(); writeFillRect(x, y, w, h, c); endWrite(); }
+void Adafruit_SPITFT::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c) { startWrite(); writeFastHLine(x, y, w, c); endWrite(); }
+void Adafruit_SPITFT::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t c) { startWrite(); writeFastVLine(x, y, h, c); endWrite(); }
+
+void Adafruit_SPITFT::writePixels(uint16_t*, uint32_t, bool, bool) {}
+void Adafruit_SPITFT::writeColor(uint16_t, uint32_t) {}
+void Adafruit_SPITFT::sendCommand(uint8_t cmd, uint8_t* data, uint8_t n) { sendCommand(cmd, (const uint8_t*)data, n); }
+void Adafruit_SPITFT::sendCommand(uint8_t, const uint8_t*, uint8_t) {}
+
+// ---- Adafruit_ST77xx / ST7789
+Adafruit_ST77xx::Adafruit_ST77xx(uint16_t w, uint16_t h, int8_t cs, int8_t dc, int8_t rst) : Adafruit_SPITFT(w, h, cs, dc, rst) {}
+void Adafruit_ST77xx::setAddrWindow(uint16_t, uint16_t, uint16_t, uint16_t) {}
+void Adafruit_ST77xx::setRotation(uint8_t r) { Adafruit_GFX::setRotation(r); }
+void Adafruit_ST77xx::enableDisplay(bool on) { sendCommand(on ? ST77XX_DISPON : ST77XX_DISPOFF); }
+void Adafruit_ST77xx::enableTearing(bool) {}
+void Adafruit_ST77xx::enableSleep(bool on) { sendCommand(on ? ST77XX_SLPIN : ST77XX_SLPOUT); }
+
+Adafruit_ST7789::Adafruit_ST7789(int8_t cs, int8_t dc, int8_t rst) : Adafruit_ST77xx(240, 320, cs, dc, rst) {}
+
+void Adafruit_ST7789::init(uint16_t width, uint16_t height, uint8_t) {
+  windowWidth = width; windowHeight = height;
+  WIDTH = _width = (int16_t)width;
+  HEIGHT = _height = (int16_t)height;
+  setRotation(0);
+}
+
+void Adafruit_ST7789::setRotation(uint8_t m) {
+  rotation = m & 3;
+  _width  = (int16_t)((rotation & 1) ? windowHeight : windowWidth);
+  _height = (int16_t)((rotation & 1) ? windowWidth : windowHeight);
+}
@@ -0,0 +1,123 @@
+// =============================
+// File: test/host/stubs/host_nvs.cpp — Preferences over an in-memory key space
+// =============================
+// Every put/remove is one write; a power cut (host::nvs.cutAt) drops the
+// write in progress and ends the process, like pulling the battery.
+#include <Preferences.h>
+#include <unistd.h>
+#include "host.h"
+
+host::Nvs host::nvs;
+
+namespace {
+  std::vector<uint8_t>* find(const char* k) {
+    auto it = host::nvs.store.find(k);
+    return it == host::nvs.store.end() ? nullptr : &it->second;
+  }
+
+  void cutPoint() {
+    host::Nvs& n = host::nvs;
+    if (n.cutAt >= 0 && (long)(n.writes + n.removes) >= n.cutAt) {
+      if (n.cutHook) n.cutHook();
+      _exit(0);
+    }
+  }
+
+  size_t put(const char* k, const void* p, size_t len) {
+    cutPoint();
+    ++host::nvs.writes;
+    host::nvs.bytesWritten += len;
+    host::nvs.store[k].assign((const uint8_t*)p, (const uint8_t*)p + len);
+    host::nvs.save();
+    return len;
+  }
+
+  template <class T> T get(const char* k, T defv) {
+    ++host::nvs.reads;
+    const std::vector<uint8_t>* v = find(k);
+    if (!v || v->size() != sizeof(T)) return defv;
+    T out; memcpy(&out, v->data(), sizeof(T));
+    return out;
+  }
+}
+
+bool host::Nvs::load() {
+  store.clear();
+  FILE* f = file ? fopen(file, "rb") : nullptr;
+  if (!f) return false;
+  uint32_t a, b;
+  while (fread(&a, 4, 1, f) == 1) {
+    std::string k(a, '\0');
+    std::vector<uint8_t> v;
+    if (fread(&k[0], 1, a, f) != a || fread(&b, 4, 1, f) != 1) break;
+    v.resize(b);
+    if (fread(v.data(), 1, b, f) != b) break;
+    store[k] = v;
+  }
+  fclose(f);
+  return true;
+}
+
+void host::Nvs::save() const {
+  if (!file) return;
+  FILE* f = fopen(file, "wb");
+  if (!f) return;
+  for (const auto& kv : store) {
+    const uint32_t a = kv.first.size(), b = kv.second.size();
+    fwrite(&a, 4, 1, f); fwrite(kv.first.data(), 1, a, f);
+    fwrite(&b, 4, 1, f); fwrite(kv.second.data(), 1, b, f);
+  }
+  fclose(f);
+}
+
+bool Preferences::begin(const char*, bool) { return true; }
+void Preferences::end() {}
+bool Preferences::isKey(const char* k) { ++host::nvs.reads; return find(k) != nullptr; }
+bool Preferences::remove(const char* k) {
+  cutPoint();
+  ++host::nvs.removes;
+  const bool had = host::nvs.store.erase(k) > 0;
+  host::nvs.save();
+  return had;
+}
+bool Preferences::clear() { host::nvs.store.clear(); host::nvs.save(); return true; }
+
+uint8_t  Preferences::getUChar(const char* k, uint8_t d)     { return get<uint8_t>(k, d); }
+size_t   Preferences::putUChar(const char* k, uint8_t v)     { return put(k, &v, sizeof(v)); }
+uint32_t Preferences::getUInt(const char* k, uint32_t d)     { return get<uint32_t>(k, d); }
+size_t   Preferences::putUInt(const char* k, uint32_t v)     { return put(k, &v, sizeof(v)); }
+uint64_t Preferences::getULong64(const char* k, uint64_t d)  { return get<uint64_t>(k, d); }
+size_t   Preferences::putULong64(const char* k, uint64_t v)  { return put(k, &v, sizeof(v)); }
+float    Preferences::getFloat(const char* k, float d)       { return get<float>(k, d); }
+size_t   Preferences::putFloat(const char* k, float v)       { return put(k, &v, sizeof(v)); }
+
+String Preferences::getString(const char* k, String d) {
+  ++host::nvs.reads;
+  const std::vector<uint8_t>* v = find(k);
+  return v && !v->empty() && v->back() == 0 ? String((const char*)v->data()) : d;
+}
+// Like NVS: the length including the terminator, 0 when missing or too long
+size_t Preferences::getString(const char* k, char* b, size_t n) {
+  ++host::nvs.reads;
+  const std::vector<uint8_t>* v = find(k);
+  if (!v || v->empty() || v->back() != 0 || v->size() > n) return 0;
+  memcpy(b, v->data(), v->size());
+  return v->size();
+}
+size_t Preferences::putString(const char* k, const char* v) { put(k, v, strlen(v) + 1); return strlen(v); }
+size_t Preferences::putString(const char* k, String v)      { return putString(k, v.c_str()); }
+
+size_t Preferences::getBytesLength(const char* k) {
+  ++host::nvs.reads;
+  const std::vector<uint8_t>* v = find(k);
+  return v ? v->size() : 0;
+}
+size_t Preferences::getBytes(const char* k, void* b, size_t n) {
+  ++host::nvs.reads;
+  const std::vector<uint8_t>* v = find(k);
+  if (!v || v->size() > n) return 0;
+  memcpy(b, v->data(), v->size());
+  return v->size();
+}
+size_t Preferences::putBytes(const char* k, const void* b, size_t n) { return put(k, b, n); }
+size_t Preferences::freeEntries() { return 500 - host::nvs.store.size(); }
@@ -0,0 +1,2 @@
+#pragma once
+#define SOC_UART_FIFO_LEN 128